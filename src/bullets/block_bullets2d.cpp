@@ -10,7 +10,7 @@ using namespace godot;
 
 namespace BlastBullets2D {
 
-void BlockBullets2D::set_up_movement_data(const BulletSpeedData2D &new_speed_data) {
+void BlockBullets2D::set_up_movement_data(const CompiledBulletSpeedData2D &new_speed_data) {
 	// Ensure all old data is removed
 	if (all_cached_speed.size() > 0) {
 		all_cached_speed.clear();
@@ -29,22 +29,52 @@ void BlockBullets2D::set_up_movement_data(const BulletSpeedData2D &new_speed_dat
 	all_cached_velocity.emplace_back(all_cached_direction[0] * all_cached_speed[0]);
 }
 
-void BlockBullets2D::custom_additional_spawn_logic(const MultiMeshBulletsData2D &data) {
-	const BlockBulletsData2D &block_data = static_cast<const BlockBulletsData2D &>(data);
+void BlockBullets2D::set_up_block(const BlockBulletsData2D &block_data) {
+	// The block moves in the direction the spawn origin is rotated by as well (the origin is identity unless spawned from a template)
+	block_rotation_radians = block_data.block_rotation_radians + spawn_origin.get_rotation();
+
+	if (is_using_compiled_data) {
+		set_up_movement_data(block_data.compiled_block_speed);
+	} else {
+		const BulletSpeedData2D &block_speed = *block_data.block_speed.ptr();
+		set_up_movement_data(CompiledBulletSpeedData2D{ block_speed.speed, block_speed.max_speed, block_speed.acceleration });
+	}
 
-	block_rotation_radians = block_data.block_rotation_radians;
-	set_up_movement_data(*block_data.block_speed.ptr());
+	set_up_rigid_block_movement(block_data.use_rigid_block_movement);
 }
 
-void BlockBullets2D::custom_additional_enable_logic(const MultiMeshBulletsData2D &data) {
-	const BlockBulletsData2D &block_data = static_cast<const BlockBulletsData2D &>(data);
+void BlockBullets2D::custom_additional_spawn_logic(const MultiMeshBulletsData2D &data) {
+	set_up_block(static_cast<const BlockBulletsData2D &>(data));
+}
 
-	block_rotation_radians = block_data.block_rotation_radians;
-	set_up_movement_data(*block_data.block_speed.ptr());
+void BlockBullets2D::custom_additional_enable_logic(const MultiMeshBulletsData2D &data) {
+	set_up_block(static_cast<const BlockBulletsData2D &>(data));
 }
 
 void BlockBullets2D::custom_additional_disable_logic(){
 	bullet_factory->block_bullets_set.disable_data(sparse_set_id);
+
+	reset_rigid_block_movement();
+}
+
+void BlockBullets2D::set_up_rigid_block_movement(bool use_rigid_block_movement) {
+	// Rotation data rotates each bullet around its own center, which can't be expressed by a single transform for the whole block
+	is_rigid_block_movement_active = use_rigid_block_movement && !is_rotation_data_active;
+
+	previous_rigid_movement_offset = rigid_movement_offset;
+}
+
+void BlockBullets2D::reset_rigid_block_movement() {
+	if (rigid_movement_offset == Vector2(0, 0)) {
+		return;
+	}
+
+	// The cached transforms are global, so bring the shapes and instances back to global space as well
+	rigid_movement_offset = Vector2(0, 0);
+	previous_rigid_movement_offset = rigid_movement_offset;
+
+	physics_server->area_set_transform(area, Transform2D());
+	set_block_position(rigid_movement_offset);
 }
 
 void BlockBullets2D::_bind_methods() {
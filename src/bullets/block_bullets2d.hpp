@@ -8,6 +8,8 @@
 namespace BlastBullets2D {
 using namespace godot;
 
+class BlockBulletsData2D;
+
 class BlockBullets2D : public MultiMeshBullets2D {
 	GDCLASS(BlockBullets2D, MultiMeshBullets2D)
 
@@ -15,76 +17,232 @@ public:
 	// The block rotation. The direction of the bullets is determined by it.
 	real_t block_rotation_radians = 0.0;
 
+	// Whether the whole block is moved by a single area transform and a single canvas item transform instead of updating every collision shape and instance each physics frame. Only possible when the bullets have no rotation data, since each bullet would need to rotate around its own center otherwise
+	bool is_rigid_block_movement_active = false;
+
 	_ALWAYS_INLINE_ void move_bullets(double delta) {
-		real_t cache_first_rotation_result = 0.0;
-		// Accelerate only the first bullet rotation speed
-		if (is_rotation_data_active) {
-			if (use_only_first_rotation_data) {
-				bullet_accelerate_rotation_speed(0, delta); // accelerate only the first one once
-				cache_first_rotation_result = all_rotation_speed[0] * delta;
+		if (prepare_simulation_frame(delta)) {
+			const int amount_active_bullets = static_cast<int>(all_bullets_enabled_set.get_active_indexes().size());
+			const bool have_any_bullets_moved = simulate_bullets_range(0, amount_active_bullets, nullptr);
+
+			if (is_rigid_block_movement_active) {
+				apply_rigid_block_transform();
+			} else {
+				have_bullets_moved = have_any_bullets_moved;
+
+				if (!bullet_factory->use_physics_interpolation && have_bullets_moved) {
+					is_instance_buffer_dirty = true;
+				}
 			}
 		}
 
-		bool is_using_physics_interpolation = bullet_factory->use_physics_interpolation;
+		// Handle collisions safely after all physics processing logic is done
+		handle_all_collided_bullets();
+	}
+
+	// Does the part of the movement that happens once per physics frame and splits the active bullets into ranges. Returns the amount of ranges (0 if the block stands still), each one has to be moved by move_bullets_range_on_worker_thread. Call apply_worker_thread_simulation_results on the main thread afterwards
+	_ALWAYS_INLINE_ int prepare_worker_thread_simulation(double delta, int max_bullets_per_range) {
+		if (!prepare_simulation_frame(delta)) {
+			amount_worker_thread_ranges = 0;
+			return 0;
+		}
+
+		return split_active_bullets_into_worker_thread_ranges(max_bullets_per_range);
+	}
+
+	// Moves a single range of bullets without touching any servers. Different ranges can be moved at the same time
+	_ALWAYS_INLINE_ void move_bullets_range_on_worker_thread(int range_index) {
+		WorkerThreadRange &range = worker_thread_ranges[range_index];
+		range.have_any_bullets_moved = simulate_bullets_range(range.active_index_begin, range.active_index_end, &range);
+	}
+
+	// Hides MultiMeshBullets2D::apply_worker_thread_simulation_results so that a rigid block only moves its area and canvas item
+	_ALWAYS_INLINE_ void apply_worker_thread_simulation_results() {
+		if (!is_rigid_block_movement_active) {
+			MultiMeshBullets2D::apply_worker_thread_simulation_results();
+			return;
+		}
+
+		// No ranges means that the block stood still
+		if (amount_worker_thread_ranges > 0) {
+			apply_rigid_block_transform();
+		}
+
+		amount_worker_thread_ranges = 0;
+		handle_all_collided_bullets();
+	}
+
+protected:
+	// The distance every bullet of the block moves during the current physics frame
+	Vector2 frame_velocity_delta = Vector2(0, 0);
+
+	// The rotation of every bullet during the current physics frame, used when all bullets share the first rotation data
+	real_t frame_rotation_angle = 0.0;
+
+	double frame_delta = 0.0;
+
+	// Transforms are written directly into the instance buffer, which gets uploaded once per frame by the factory. Getting the write pointer may copy the buffer, so it is done once on the main thread and not by every range
+	float *frame_instance_buffer_ptr = nullptr;
+
+	// Calculates everything that is the same for all bullets during this physics frame (the whole block shares a single velocity). Always runs on the main thread. Returns false if nothing moves, so there is nothing to simulate
+	_ALWAYS_INLINE_ bool prepare_simulation_frame(double delta) {
+		frame_delta = delta;
+		frame_velocity_delta = all_cached_velocity[0] * delta;
+
+		if (is_rigid_block_movement_active) {
+			previous_rigid_movement_offset = rigid_movement_offset;
+			bullet_accelerate_speed(0, delta);
+
+			// The block stands still, so the area and the canvas item are already where they should be
+			if (frame_velocity_delta == Vector2(0, 0)) {
+				return false;
+			}
+
+			rigid_movement_offset += frame_velocity_delta;
+			return true;
+		}
+
+		frame_rotation_angle = 0.0;
+		// Accelerate only the first bullet rotation speed
+		if (is_rotation_data_active && use_only_first_rotation_data) {
+			bullet_accelerate_rotation_speed(0, delta); // accelerate only the first one once
+			frame_rotation_angle = all_rotation_speed[0] * delta;
+		}
 
 		update_all_previous_transforms_for_interpolation();
 
-		Vector2 cache_velocity_calc = all_cached_velocity[0] * delta;
+		bullet_accelerate_speed(0, delta);
+
+		frame_instance_buffer_ptr = instance_buffer.ptrw();
 
+		// The whole block stands still (e.g. a wall of stationary hazards), so there is nothing to sync with the servers
+		if (frame_velocity_delta == Vector2(0, 0) && !is_rotation_data_active) {
+			have_bullets_moved = false;
+			return false;
+		}
+
+		return true;
+	}
+
+	// The movement logic - moves the active bullets from active_index_begin up to (but not including) active_index_end using the data calculated by prepare_simulation_frame. Returns whether any of the bullets moved. When worker_thread_range is not nullptr, the servers are NOT updated, only the cached transforms are
+	_ALWAYS_INLINE_ bool simulate_bullets_range(int active_index_begin, int active_index_end, WorkerThreadRange *worker_thread_range) {
 		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
 
-		for (int i : active_bullet_indexes) {
+		// The area and the canvas item carry the movement of a rigid block, so only keep the cached global transforms up to date, since getters, collision signals and the debugger rely on them (only memory writes, no server calls)
+		if (is_rigid_block_movement_active) {
+			for (int active_index = active_index_begin; active_index < active_index_end; ++active_index) {
+				const int i = active_bullet_indexes[active_index];
+
+				Vector2 &curr_instance_origin = all_cached_instance_origin[i];
+				Vector2 &curr_shape_origin = all_cached_shape_origin[i];
+
+				curr_instance_origin += frame_velocity_delta;
+				curr_shape_origin += frame_velocity_delta;
+
+				all_cached_instance_transforms[i].set_origin(curr_instance_origin);
+				all_cached_shape_transforms[i].set_origin(curr_shape_origin);
+			}
+
+			return true;
+		}
+
+		bool is_using_physics_interpolation = bullet_factory->use_physics_interpolation;
+
+		float *instance_buffer_ptr = frame_instance_buffer_ptr;
+
+		bool have_any_bullets_moved = false;
+
+		for (int active_index = active_index_begin; active_index < active_index_end; ++active_index) {
+			const int i = active_bullet_indexes[active_index];
+
 			Transform2D &curr_instance_transf = all_cached_instance_transforms[i];
-			Transform2D &curr_shape_transf = all_cached_shape_transforms[i];
+			Transform2D new_shape_transf = all_cached_shape_transforms[i];
 
 			Vector2 &curr_instance_origin = all_cached_instance_origin[i];
 			Vector2 &curr_shape_origin = all_cached_shape_origin[i];
 
-			curr_instance_origin += cache_velocity_calc;
-			curr_shape_origin += cache_velocity_calc;
+			curr_instance_origin += frame_velocity_delta;
+			curr_shape_origin += frame_velocity_delta;
 
 			// Handle bullet rotation and bullet rotation speed acceleration
 			real_t rotation_angle = 0.0;
 			if (is_rotation_data_active) {
 				if (!use_only_first_rotation_data) {
-					bullet_accelerate_rotation_speed(0, delta);
-					rotation_angle = all_rotation_speed[i] * delta;
+					bullet_accelerate_rotation_speed(i, frame_delta);
+					rotation_angle = all_rotation_speed[i] * frame_delta;
 				} else {
-					rotation_angle = cache_first_rotation_result;
+					rotation_angle = frame_rotation_angle;
 				}
 
 				rotate_transform_locally(curr_instance_transf, rotation_angle);
 
 				if (!rotate_only_textures) {
-					rotate_transform_locally(curr_shape_transf, rotation_angle);
+					rotate_transform_locally(new_shape_transf, rotation_angle);
 				}
 			}
 
+			// When only the textures rotate, the instance can change while the shape stays in place
+			const bool has_instance_changed = frame_velocity_delta != Vector2(0, 0) || rotation_angle != 0.0;
+			have_any_bullets_moved |= has_instance_changed;
+
 			curr_instance_transf.set_origin(curr_instance_origin);
-			curr_shape_transf.set_origin(curr_shape_origin);
+			new_shape_transf.set_origin(curr_shape_origin);
 
-			physics_server->area_set_shape_transform(area, i, curr_shape_transf);
+			sync_shape_transform_if_changed(i, new_shape_transf, worker_thread_range);
 
 			// If we are not using physics interpolation then just render the texture in the current physics frame
-			if (!is_using_physics_interpolation) {
-				multi->set_instance_transform_2d(i, curr_instance_transf);
+			if (!is_using_physics_interpolation && has_instance_changed) {
+				write_instance_buffer_transform(instance_buffer_ptr, i, curr_instance_transf);
 			}
 
-			//move_bullet_attachment(cache_velocity_calc, i); // Block bullets do not expose an API for attachments, use directional instead
+			//move_bullet_attachment(frame_velocity_delta, i); // Block bullets do not expose an API for attachments, use directional instead
 		}
 
-		bullet_accelerate_speed(0, delta);
+		return have_any_bullets_moved;
+	}
 
-		// Handle collisions safely after all physics processing logic is done
-		for (auto &data : all_collided_bullets) {
-			handle_bullet_collision(data.collision_type, data.bullet_index, data.collided_instance_id);
+public:
+	// Applies the rigid_movement_offset to the area and to the canvas item
+	_ALWAYS_INLINE_ void apply_rigid_block_transform() {
+		physics_server->area_set_transform(area, Transform2D(0.0, rigid_movement_offset));
+
+		// If we are not using physics interpolation then just move the canvas item in the current physics frame
+		if (!bullet_factory->use_physics_interpolation) {
+			set_block_position(rigid_movement_offset);
 		}
-		all_collided_bullets.clear();
+	}
+
+	// Hides MultiMeshBullets2D::interpolate_bullet_visuals so that a rigid block interpolates only the canvas item position
+	_ALWAYS_INLINE_ void interpolate_bullet_visuals() {
+		if (!is_rigid_block_movement_active) {
+			MultiMeshBullets2D::interpolate_bullet_visuals();
+			return;
+		}
+
+		double fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
+		set_block_position(previous_rigid_movement_offset.lerp(rigid_movement_offset, fraction));
 	}
 
 protected:
+	// Moves the canvas item of the whole block. The instance transforms stay relative to it
+	_ALWAYS_INLINE_ void set_block_position(const Vector2 &new_position) {
+		rendering_server->canvas_item_set_transform(canvas_item, Transform2D(0.0, new_position));
+	}
+
+	// The rigid_movement_offset from the previous physics frame. Used for physics interpolation
+	Vector2 previous_rigid_movement_offset = Vector2(0, 0);
+
+	// Determines whether the block can be moved as a rigid unit
+	void set_up_rigid_block_movement(bool use_rigid_block_movement);
+
+	// Moves the area and the canvas item back to the origin so the shape and instance transforms are global again
+	void reset_rigid_block_movement();
+
 	static void _bind_methods();
-	void set_up_movement_data(const BulletSpeedData2D &new_speed_data);
+	void set_up_movement_data(const CompiledBulletSpeedData2D &new_speed_data);
+
+	// Sets up the rotation, the speed and the rigid movement from the spawn data. Same for spawning and enabling
+	void set_up_block(const BlockBulletsData2D &block_data);
 
 	virtual void custom_additional_spawn_logic(const MultiMeshBulletsData2D &data) override final;
 	virtual void custom_additional_enable_logic(const MultiMeshBulletsData2D &data) override final;
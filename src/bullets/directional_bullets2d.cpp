@@ -69,19 +69,53 @@ void DirectionalBullets2D::set_up_movement_data(const TypedArray<BulletSpeedData
 	}
 }
 
+void DirectionalBullets2D::set_up_movement_data(const std::vector<CompiledBulletSpeedData2D> &new_speed_data) {
+	if ((int)all_cached_speed.size() != amount_bullets) {
+		all_cached_speed.resize(amount_bullets);
+		all_cached_max_speed.resize(amount_bullets);
+		all_cached_acceleration.resize(amount_bullets);
+		all_cached_direction.resize(amount_bullets);
+		all_cached_velocity.resize(amount_bullets);
+	}
+
+	// The compiled data holds either one entry per bullet or a single entry for all bullets
+	const bool use_per_bullet = static_cast<int>(new_speed_data.size()) == amount_bullets;
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		const CompiledBulletSpeedData2D &data = new_speed_data[use_per_bullet ? i : 0];
+		const real_t rot = all_cached_shape_transforms[i].get_rotation();
+
+		all_cached_speed[i] = data.speed;
+		all_cached_max_speed[i] = data.max_speed;
+		all_cached_acceleration[i] = data.acceleration;
+
+		Vector2 dir = Vector2(Math::cos(rot), Math::sin(rot));
+		all_cached_direction[i] = dir;
+		all_cached_velocity[i] = (dir * data.speed) + inherited_velocity_offset;
+	}
+}
+
+void DirectionalBullets2D::set_up_movement_data(const DirectionalBulletsData2D &data) {
+	if (is_using_compiled_data) {
+		set_up_movement_data(data.compiled_speed_data);
+	} else {
+		set_up_movement_data(data.all_bullet_speed_data);
+	}
+}
+
 void DirectionalBullets2D::custom_additional_spawn_logic(const MultiMeshBulletsData2D &data) {
 	const DirectionalBulletsData2D &directional_data = static_cast<const DirectionalBulletsData2D &>(data);
 
-	set_up_movement_data(directional_data.all_bullet_speed_data);
+	set_up_movement_data(directional_data);
 
 	adjust_direction_based_on_rotation = directional_data.adjust_direction_based_on_rotation;
 
 	// Each bullet can have its own homing target
-	all_bullet_homing_targets.resize(amount_bullets); // Create a vector that contains an empty queue for each bullet index
+	all_bullet_homing_targets.resize(amount_bullets_capacity); // Create a vector that contains an empty queue for each bullet index (sized by the capacity, since this vector is never resized again)
 	all_homing_count.resize(amount_bullets, 0);
 
 	// Orbiting
-	all_orbiting_data.resize(amount_bullets); // Create a vector that contains an empty orbiting data for each bullet index
+	all_orbiting_data.resize(amount_bullets_capacity); // Create a vector that contains an empty orbiting data for each bullet index
 	all_orbiting_status.resize(amount_bullets, 0); // Initialize all orbiting status to disabled
 }
 
@@ -98,7 +132,7 @@ void DirectionalBullets2D::custom_additional_enable_logic(const MultiMeshBullets
 		disconnect("bullet_homing_target_reached", callable);
 	}
 
-	set_up_movement_data(directional_data.all_bullet_speed_data);
+	set_up_movement_data(directional_data);
 
 	adjust_direction_based_on_rotation = directional_data.adjust_direction_based_on_rotation;
 
@@ -135,7 +169,91 @@ void DirectionalBullets2D::custom_additional_disable_logic() {
 	bullet_factory->directional_bullets_set.disable_data(sparse_set_id);
 }
 
+void DirectionalBullets2D::set_up_emitted_bullet_movement(int bullet_index, const CompiledBulletSpeedData2D &speed_data) {
+	const real_t rot = all_cached_shape_transforms[bullet_index].get_rotation();
+	const Vector2 dir = Vector2(Math::cos(rot), Math::sin(rot));
+
+	all_cached_speed[bullet_index] = speed_data.speed;
+	all_cached_max_speed[bullet_index] = speed_data.max_speed;
+	all_cached_acceleration[bullet_index] = speed_data.acceleration;
+	all_cached_direction[bullet_index] = dir;
+	all_cached_velocity[bullet_index] = (dir * speed_data.speed) + inherited_velocity_offset;
+
+	// The previous bullet in this slot might have been homing or orbiting
+	if (all_homing_count[bullet_index] > 0) {
+		bullet_clear_homing_targets(bullet_index);
+	}
+
+	if (all_orbiting_status[bullet_index] != 0) {
+		bullet_disable_orbiting(bullet_index);
+	}
+}
+
+int DirectionalBullets2D::emit_bullet(const Transform2D &transform, real_t speed, real_t max_speed, real_t acceleration, double life_time) {
+	if (!is_emitter) {
+		UtilityFunctions::push_error("Error when trying to emit a bullet. The DirectionalBullets2D is not an emitter. Ignoring the request");
+		return -1;
+	}
+
+	const int bullet_index = acquire_emitter_slot();
+	if (bullet_index == -1) {
+		return -1;
+	}
+
+	set_up_emitted_bullet(bullet_index, transform);
+	set_up_emitted_bullet_movement(bullet_index, CompiledBulletSpeedData2D{ speed, max_speed, acceleration });
+
+	if (life_time > 0.0) {
+		bullet_expiry_wheel.schedule(bullet_index, life_time);
+	}
+
+	return bullet_index;
+}
+
+int DirectionalBullets2D::emit_bullets_from_template(const Ref<DirectionalBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians, double life_time) {
+	if (!is_emitter) {
+		UtilityFunctions::push_error("Error when trying to emit bullets. The DirectionalBullets2D is not an emitter. Ignoring the request");
+		return 0;
+	}
+
+	if (spawn_template.is_null() || !spawn_template->get_is_compiled()) {
+		UtilityFunctions::push_error("Error when trying to emit bullets. The template is null or not compiled. Ignoring the request");
+		return 0;
+	}
+
+	const Transform2D emit_origin(rotation_radians, origin);
+	const std::vector<Transform2D> &template_transforms = spawn_template->compiled_transforms;
+	const std::vector<CompiledBulletSpeedData2D> &template_speed_data = spawn_template->compiled_speed_data;
+
+	const int amount_template_bullets = static_cast<int>(template_transforms.size());
+	const bool use_per_bullet_speed = static_cast<int>(template_speed_data.size()) == amount_template_bullets;
+
+	int amount_emitted = 0;
+
+	for (int i = 0; i < amount_template_bullets; ++i) {
+		const int bullet_index = acquire_emitter_slot();
+		if (bullet_index == -1) {
+			break;
+		}
+
+		set_up_emitted_bullet(bullet_index, emit_origin * template_transforms[i]);
+		set_up_emitted_bullet_movement(bullet_index, template_speed_data[use_per_bullet_speed ? i : 0]);
+
+		if (life_time > 0.0) {
+			bullet_expiry_wheel.schedule(bullet_index, life_time);
+		}
+
+		++amount_emitted;
+	}
+
+	return amount_emitted;
+}
+
 void DirectionalBullets2D::_bind_methods() {
+	// EMITTER
+	ClassDB::bind_method(D_METHOD("emit_bullet", "transform", "speed", "max_speed", "acceleration", "life_time"), &DirectionalBullets2D::emit_bullet, DEFVAL(0.0), DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("emit_bullets_from_template", "spawn_template", "origin", "rotation_radians", "life_time"), &DirectionalBullets2D::emit_bullets_from_template, DEFVAL(0.0), DEFVAL(0.0));
+
 	// PER BULLET HOMING DEQUE POP METHODS
 	ClassDB::bind_method(D_METHOD("bullet_homing_pop_front_target", "bullet_index"), &DirectionalBullets2D::bullet_homing_pop_front_target);
 	ClassDB::bind_method(D_METHOD("bullet_homing_pop_back_target", "bullet_index"), &DirectionalBullets2D::bullet_homing_pop_back_target);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../shared/bullet_simd_kernels.hpp"
+#include "../shared/bullet_soa_state2d.hpp"
 #include "../shared/bullet_speed_data2d.hpp"
 #include "../shared/homing_target_deque.hpp"
 #include "godot_cpp/classes/node2d.hpp"
@@ -24,6 +26,8 @@
 namespace BlastBullets2D {
 using namespace godot;
 
+class DirectionalBulletsData2D;
+
 class DirectionalBullets2D : public MultiMeshBullets2D {
 	GDCLASS(DirectionalBullets2D, MultiMeshBullets2D)
 
@@ -104,107 +108,358 @@ protected:
 public:
 	// Updates all bullets' positions, rotations, and homing
 	_ALWAYS_INLINE_ void move_bullets(double delta) {
-		const bool is_using_physics_interpolation = bullet_factory->use_physics_interpolation;
-		update_all_previous_transforms_for_interpolation();
+		prepare_simulation_frame(delta);
+
+		const int amount_active_bullets = static_cast<int>(all_bullets_enabled_set.get_active_indexes().size());
+		have_bullets_moved = simulate_bullets_range(0, amount_active_bullets, nullptr, nullptr);
+
+		// Bullets that stand still were not written to the instance buffer, so if none of them moved there is nothing to upload
+		if (!bullet_factory->use_physics_interpolation && have_bullets_moved) {
+			is_instance_buffer_dirty = true;
+		}
+
+		// Handle collisions safely after all physics processing logic is done
+		handle_all_collided_bullets();
+	}
+
+	// Does the part of the movement that happens once per physics frame on the main thread (including refreshing the cached positions of the homing targets, so that the worker threads never read any nodes) and splits the active bullets into ranges. Returns the amount of ranges, each one has to be moved by move_bullets_range_on_worker_thread. Call apply_worker_thread_simulation_results on the main thread afterwards
+	_ALWAYS_INLINE_ int prepare_worker_thread_simulation(double delta, int max_bullets_per_range) {
+		prepare_simulation_frame(delta);
+
+		const int amount_ranges = split_active_bullets_into_worker_thread_ranges(max_bullets_per_range);
+
+		if (static_cast<int>(worker_thread_range_commands.size()) < amount_ranges) {
+			worker_thread_range_commands.resize(amount_ranges);
+		}
+
+		return amount_ranges;
+	}
+
+	// Moves a single range of bullets without touching any nodes or servers. Different ranges can be moved at the same time
+	_ALWAYS_INLINE_ void move_bullets_range_on_worker_thread(int range_index) {
+		WorkerThreadRange &range = worker_thread_ranges[range_index];
+		range.have_any_bullets_moved = simulate_bullets_range(range.active_index_begin, range.active_index_end, &range, &worker_thread_range_commands[range_index]);
+	}
+
+	// Hides MultiMeshBullets2D::apply_worker_thread_simulation_results so that the commands queued by the ranges are applied as well. They are applied range by range, which is the same order in which they would have happened on the main thread
+	_ALWAYS_INLINE_ void apply_worker_thread_simulation_results() {
+		const bool is_using_shared_homing_deque = simulation_frame.shared_homing_deque_enabled;
+
+		for (int r = 0; r < amount_worker_thread_ranges; ++r) {
+			WorkerThreadRangeCommands &commands = worker_thread_range_commands[r];
+
+			for (const HomingTargetReachedCommand &command : commands.homing_targets_reached) {
+				HomingTargetDeque &homing_deque = is_using_shared_homing_deque ? shared_homing_deque : all_bullet_homing_targets[command.bullet_index];
+				handle_homing_target_reached(homing_deque, is_using_shared_homing_deque, command.bullet_index, command.target_pos);
+			}
+
+			for (int i : commands.bullets_with_finished_movement_patterns) {
+				all_movement_pattern_data.erase(i);
+			}
+
+			commands.homing_targets_reached.clear();
+			commands.bullets_with_finished_movement_patterns.clear();
+		}
+
+		MultiMeshBullets2D::apply_worker_thread_simulation_results();
+	}
+
+protected:
+	// The movement features a loop of simulate_bullets_loop is compiled with
+	enum SimulationFeatures : uint32_t {
+		SIMULATE_NONE = 0,
+		SIMULATE_HOMING = 1 << 0, // Includes orbiting, since orbiting relies on the homing targets
+		SIMULATE_CURVES = 1 << 1,
+		SIMULATE_ROTATION = 1 << 2,
+		SIMULATE_ADJUST_DIRECTION = 1 << 3,
+		SIMULATE_MOVEMENT_PATTERNS = 1 << 4,
+		SIMULATE_ALL = SIMULATE_HOMING | SIMULATE_CURVES | SIMULATE_ROTATION | SIMULATE_ADJUST_DIRECTION | SIMULATE_MOVEMENT_PATTERNS
+	};
+
+	// Everything prepare_simulation_frame calculates once per physics frame before any of the bullets are moved
+	struct SimulationFrameData {
+		double delta = 0.0;
+		bool is_using_physics_interpolation = false;
+
+		uint32_t features = SIMULATE_NONE;
+
+		// Whether the bullets only move in a straight line (optionally all rotating by the same angle), so the state can be processed by the SIMD kernels
+		bool use_straight_line = false;
+		real_t straight_line_rotation_angle = 0.0;
 
 		bool homing_interval_reached = false;
+		bool shared_homing_deque_enabled = false;
+		bool is_per_bullet_homing_enabled = false;
+		bool is_orbiting_feature_enabled = false;
+
+		const BulletCurvesData2D *shared_curves_ptr = nullptr;
+		bool shared_curves_data_enabled = false;
+		bool shared_curves_x_direction_curve_valid = false;
+		bool shared_curves_y_direction_curve_valid = false;
+		bool shared_curves_rotation_curve_valid = false;
+		bool shared_curves_acceleration_curve_valid = false;
+		real_t shared_curves_x_direction_offset = 0.0;
+		real_t shared_curves_y_direction_offset = 0.0;
+		real_t shared_curves_rotation_speed = 0.0;
+		real_t shared_curves_movement_speed = 0.0;
+
+		float *instance_buffer_ptr = nullptr;
+	};
+
+	SimulationFrameData simulation_frame;
+
+	// A bullet that reached its homing target while being moved on a worker thread. Emitting the signal and popping the target is done on the main thread
+	struct HomingTargetReachedCommand {
+		int bullet_index = 0;
+		Vector2 target_pos;
+
+		HomingTargetReachedCommand() = default;
+		HomingTargetReachedCommand(int new_bullet_index, const Vector2 &new_target_pos) :
+				bullet_index(new_bullet_index),
+				target_pos(new_target_pos) {}
+	};
+
+	// Everything a worker thread range can't do by itself, because it would touch nodes or state that is shared with the other ranges
+	struct WorkerThreadRangeCommands {
+		std::vector<HomingTargetReachedCommand> homing_targets_reached;
+
+		// Removing movement pattern data moves the data of other bullets around, so it can't happen while the other ranges are reading it
+		std::vector<int> bullets_with_finished_movement_patterns;
+	};
+
+	// Indexed the same way as worker_thread_ranges
+	std::vector<WorkerThreadRangeCommands> worker_thread_range_commands;
+
+	// Calculates everything that is the same for all bullets during this physics frame and refreshes the homing targets. Always runs on the main thread
+	_ALWAYS_INLINE_ void prepare_simulation_frame(double delta) {
+		SimulationFrameData &frame = simulation_frame;
+		frame = SimulationFrameData();
+
+		frame.delta = delta;
+		frame.is_using_physics_interpolation = bullet_factory->use_physics_interpolation;
+		update_all_previous_transforms_for_interpolation();
 
-		bool shared_homing_deque_enabled = !shared_homing_deque.empty();
-		const bool is_per_bullet_homing_enabled = (active_homing_count > 0);
+		frame.shared_homing_deque_enabled = !shared_homing_deque.empty();
+		frame.is_per_bullet_homing_enabled = (active_homing_count > 0);
 
 		// If homing is enabled (either shared or per-bullet) update the timer and cache mouse position if needed
-		if (shared_homing_deque_enabled || is_per_bullet_homing_enabled) {
+		if (frame.shared_homing_deque_enabled || frame.is_per_bullet_homing_enabled) {
 			// Update homing timer / how often to update the homing target position
-			homing_interval_reached = update_homing_timer(delta);
+			frame.homing_interval_reached = update_homing_timer(delta);
 
 			// In case we have the mouse as a homing target, make sure to cache its global position
-			if (homing_interval_reached && HomingTargetDeque::mouse_homing_targets_amount > 0) {
-				cached_mouse_global_position = get_global_mouse_position();
+			if (frame.homing_interval_reached && HomingTargetDeque::mouse_homing_targets_amount > 0) {
+				cached_mouse_global_position = bullet_factory->get_global_mouse_position();
 			}
 		}
 
 		// Since shared homing deque is used for all bullets, do this once
-		if (shared_homing_deque_enabled) {
+		if (frame.shared_homing_deque_enabled) {
 			// Delete any invalid (freed) targets
 			auto targets_amount = shared_homing_deque.get_homing_targets_amount();
 			int trimmed = shared_homing_deque.bullet_homing_trim_front_invalid_targets(cached_mouse_global_position, targets_amount);
-			shared_homing_deque_enabled = (targets_amount - trimmed) > 0;
+			frame.shared_homing_deque_enabled = (targets_amount - trimmed) > 0;
 
 			// If timer timed out, refresh the cached global position of the front target
-			if (shared_homing_deque_enabled && homing_interval_reached) {
+			if (frame.shared_homing_deque_enabled && frame.homing_interval_reached) {
 				shared_homing_deque.refresh_cached_front_target_global_position(cached_mouse_global_position);
 			}
 		}
 
-		const bool is_orbiting_feature_enabled = (active_orbiting_count > 0);
+		// Loop only through ACTIVE bullets (skip the disabled ones)
+		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
 
-		Vector2 homing_bullet_pos;
-		Vector2 homing_target_pos;
+		// Same for the per-bullet deques (the shared deque takes precedence, so they are not used at all if it has targets). After this the movement only reads the cached target positions
+		if (frame.is_per_bullet_homing_enabled && !frame.shared_homing_deque_enabled) {
+			for (int i : active_bullet_indexes) {
+				// Whether the deque has any targets
+				auto &curr_homing_count = all_homing_count[i];
+
+				if (curr_homing_count <= 0) {
+					continue;
+				}
+
+				auto &curr_homing_deque = all_bullet_homing_targets[i];
+
+				// Trim the invalid ones
+				int trimmed_count = curr_homing_deque.bullet_homing_trim_front_invalid_targets(cached_mouse_global_position, curr_homing_count);
 
-		const bool shared_curves_data_enabled = shared_bullet_curves_data.is_valid();
+				// Very important to keep track of the amount of targets after trimming
+				curr_homing_count -= trimmed_count; // count for the deque
+				active_homing_count -= trimmed_count; // global count across all bullets that determines whether the per-bullet homing feature is even active
+
+				// If per bullet homing is indeed active, then refresh the cache if interval has been reached
+				if (curr_homing_count > 0 && frame.homing_interval_reached) {
+					curr_homing_deque.refresh_cached_front_target_global_position(cached_mouse_global_position);
+				}
+			}
+
+			frame.is_per_bullet_homing_enabled = (active_homing_count > 0);
+		}
+
+		frame.is_orbiting_feature_enabled = (active_orbiting_count > 0);
+
+		frame.shared_curves_data_enabled = shared_bullet_curves_data.is_valid();
 		const BulletCurvesData2D *const shared_curves_ptr = shared_bullet_curves_data.ptr();
+		frame.shared_curves_ptr = shared_curves_ptr;
+
+		frame.shared_curves_x_direction_curve_valid = frame.shared_curves_data_enabled && shared_curves_ptr->x_direction_curve.is_valid();
+		frame.shared_curves_y_direction_curve_valid = frame.shared_curves_data_enabled && shared_curves_ptr->y_direction_curve.is_valid();
 
-		const bool shared_curves_x_direction_curve_valid = shared_curves_data_enabled && shared_curves_ptr->x_direction_curve.is_valid();
-		const bool shared_curves_y_direction_curve_valid = shared_curves_data_enabled && shared_curves_ptr->y_direction_curve.is_valid();
+		frame.shared_curves_rotation_curve_valid = frame.shared_curves_data_enabled && shared_curves_ptr->rotation_speed_curve.is_valid();
+		frame.shared_curves_acceleration_curve_valid = frame.shared_curves_data_enabled && shared_curves_ptr->movement_speed_curve.is_valid();
 
-		const bool shared_curves_rotation_curve_valid = shared_curves_data_enabled && shared_curves_ptr->rotation_speed_curve.is_valid();
-		const bool shared_curves_acceleration_curve_valid = shared_curves_data_enabled && shared_curves_ptr->movement_speed_curve.is_valid();
+		// curves_elapsed_time is the same for every bullet, so the shared curves are sampled only once per physics frame
+		frame.shared_curves_x_direction_offset = frame.shared_curves_x_direction_curve_valid ? get_bullet_curves_x_direction_offset(shared_curves_ptr) : 0.0;
+		frame.shared_curves_y_direction_offset = frame.shared_curves_y_direction_curve_valid ? get_bullet_curves_y_direction_offset(shared_curves_ptr) : 0.0;
+		frame.shared_curves_rotation_speed = frame.shared_curves_rotation_curve_valid ? get_bullet_curves_rotation_speed(shared_curves_ptr) : 0.0;
+		frame.shared_curves_movement_speed = frame.shared_curves_acceleration_curve_valid ? get_bullet_curves_movement_speed(shared_curves_ptr) : 0.0;
+
+		// Pick the movement loop that was compiled only with the features these bullets actually use. Anything that isn't one of the common combinations uses the fully general loop
+		if (frame.shared_homing_deque_enabled || frame.is_per_bullet_homing_enabled) {
+			frame.features |= SIMULATE_HOMING;
+		}
+		if (frame.shared_curves_data_enabled || !all_bullet_curves_data.empty()) {
+			frame.features |= SIMULATE_CURVES;
+		}
+		if (is_rotation_data_active) {
+			frame.features |= SIMULATE_ROTATION;
+		}
+		if (adjust_direction_based_on_rotation) {
+			frame.features |= SIMULATE_ADJUST_DIRECTION;
+		}
+		if (!all_movement_pattern_data.empty()) {
+			frame.features |= SIMULATE_MOVEMENT_PATTERNS;
+		}
+
+		// If the bullets only move in a straight line, the state of the active bullets can be processed by the SIMD kernels
+		if (frame.features == SIMULATE_NONE) {
+			frame.use_straight_line = true;
+		}
+
+		// A single rotation data shared by all bullets rotates every bullet by the same angle, so that can be done by the SIMD kernels as well
+		if (frame.features == SIMULATE_ROTATION && use_only_first_rotation_data) {
+			const real_t rotation_speed = all_rotation_speed[0];
+			const bool max_reached = rotation_speed >= all_max_rotation_speed[0];
+
+			if (rotation_speed != 0.0 && !(max_reached && stop_rotation_when_max_reached)) {
+				frame.straight_line_rotation_angle = rotation_speed * static_cast<real_t>(delta);
+			}
+
+			bullet_accelerate_rotation_speed(0, delta);
+
+			frame.use_straight_line = true;
+		}
+
+		// Allocating can't happen on a worker thread, since all ranges share the same arrays
+		if (frame.use_straight_line) {
+			straight_line_state.reserve(static_cast<int>(active_bullet_indexes.size()));
+		}
+
+		// Transforms are written directly into the instance buffer, which gets uploaded once per frame by the factory. Getting the write pointer may copy the buffer, so it has to happen here and not on a worker thread
+		frame.instance_buffer_ptr = instance_buffer.ptrw();
+	}
+
+	// The movement logic - moves the active bullets from active_index_begin up to (but not including) active_index_end using the data calculated by prepare_simulation_frame. Returns whether any of the bullets moved.
+	// When worker_thread_range and commands are not nullptr, the bullets are moved on a worker thread: the collision shapes and the attachments are NOT updated on the servers, only the cached transforms are, and everything that touches nodes or state shared with the other ranges is queued as a command instead
+	_ALWAYS_INLINE_ bool simulate_bullets_range(int active_index_begin, int active_index_end, WorkerThreadRange *worker_thread_range, WorkerThreadRangeCommands *commands) {
+		const SimulationFrameData &frame = simulation_frame;
+
+		if (frame.use_straight_line) {
+			return simulate_bullets_straight_line(frame, active_index_begin, active_index_end, worker_thread_range);
+		}
+
+		switch (frame.features) {
+			case SIMULATE_NONE:
+				return simulate_bullets_loop<SIMULATE_NONE>(frame, active_index_begin, active_index_end, worker_thread_range, commands);
+			case SIMULATE_ROTATION:
+				return simulate_bullets_loop<SIMULATE_ROTATION>(frame, active_index_begin, active_index_end, worker_thread_range, commands);
+			case SIMULATE_ROTATION | SIMULATE_ADJUST_DIRECTION:
+				return simulate_bullets_loop<SIMULATE_ROTATION | SIMULATE_ADJUST_DIRECTION>(frame, active_index_begin, active_index_end, worker_thread_range, commands);
+			case SIMULATE_CURVES:
+				return simulate_bullets_loop<SIMULATE_CURVES>(frame, active_index_begin, active_index_end, worker_thread_range, commands);
+			case SIMULATE_MOVEMENT_PATTERNS:
+				return simulate_bullets_loop<SIMULATE_MOVEMENT_PATTERNS>(frame, active_index_begin, active_index_end, worker_thread_range, commands);
+			case SIMULATE_HOMING:
+				return simulate_bullets_loop<SIMULATE_HOMING>(frame, active_index_begin, active_index_end, worker_thread_range, commands);
+			default:
+				return simulate_bullets_loop<SIMULATE_ALL>(frame, active_index_begin, active_index_end, worker_thread_range, commands);
+		}
+	}
+
+	// The per-bullet movement loop. Every feature that isn't part of TFeatures is compiled out, so the bullets only pay for the features they use
+	template <uint32_t TFeatures>
+	_ALWAYS_INLINE_ bool simulate_bullets_loop(const SimulationFrameData &frame, int active_index_begin, int active_index_end, WorkerThreadRange *worker_thread_range, WorkerThreadRangeCommands *commands) {
+		constexpr bool use_homing = (TFeatures & SIMULATE_HOMING) != 0;
+		constexpr bool use_curves = (TFeatures & SIMULATE_CURVES) != 0;
+		constexpr bool use_rotation = (TFeatures & SIMULATE_ROTATION) != 0;
+		constexpr bool use_adjust_direction = (TFeatures & SIMULATE_ADJUST_DIRECTION) != 0;
+		constexpr bool use_movement_patterns = (TFeatures & SIMULATE_MOVEMENT_PATTERNS) != 0;
+
+		const double delta = frame.delta;
+		const bool is_on_worker_thread = worker_thread_range != nullptr;
+		const bool is_using_physics_interpolation = frame.is_using_physics_interpolation;
+		const bool shared_homing_deque_enabled = use_homing && frame.shared_homing_deque_enabled;
+		const bool is_per_bullet_homing_enabled = use_homing && frame.is_per_bullet_homing_enabled;
+		const bool is_orbiting_feature_enabled = use_homing && frame.is_orbiting_feature_enabled;
+		const BulletCurvesData2D *const shared_curves_ptr = frame.shared_curves_ptr;
+		const bool shared_curves_data_enabled = use_curves && frame.shared_curves_data_enabled;
+		const bool shared_curves_x_direction_curve_valid = use_curves && frame.shared_curves_x_direction_curve_valid;
+		const bool shared_curves_y_direction_curve_valid = use_curves && frame.shared_curves_y_direction_curve_valid;
+		const bool shared_curves_rotation_curve_valid = use_curves && frame.shared_curves_rotation_curve_valid;
+		const bool shared_curves_acceleration_curve_valid = use_curves && frame.shared_curves_acceleration_curve_valid;
+		const real_t shared_curves_x_direction_offset = frame.shared_curves_x_direction_offset;
+		const real_t shared_curves_y_direction_offset = frame.shared_curves_y_direction_offset;
+		const real_t shared_curves_rotation_speed = frame.shared_curves_rotation_speed;
+		const real_t shared_curves_movement_speed = frame.shared_curves_movement_speed;
+		const bool is_rotation_enabled = use_rotation && is_rotation_data_active;
+		float *instance_buffer_ptr = frame.instance_buffer_ptr;
 
 		bool is_per_bullet_curves_valid = false;
 		const BulletCurvesData2D *per_bullet_curves_data = nullptr;
 
-		// Loop only through ACTIVE bullets (skip the disabled ones)
+		Vector2 homing_bullet_pos;
+		Vector2 homing_target_pos;
+
 		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
 
-		for (int i : active_bullet_indexes) {
+		bool have_any_bullets_moved = false;
+
+		for (int active_index = active_index_begin; active_index < active_index_end; ++active_index) {
+			const int i = active_bullet_indexes[active_index];
 			bool direction_got_updated = false;
 			HomingTargetDeque *target_deque_used_for_orbiting = nullptr;
 
 			// 1. STANDARD HOMING PHASE
-			if (shared_homing_deque_enabled) { // Handle homing towards shared deque (takes precedence over per-bullet homing)
+			if constexpr (!use_homing) {
+				// Homing is compiled out
+			} else if (shared_homing_deque_enabled) { // Handle homing towards shared deque (takes precedence over per-bullet homing)
 				update_homing(shared_homing_deque, i, delta, homing_bullet_pos, homing_target_pos);
-				try_to_emit_bullet_homing_target_reached_signal(shared_homing_deque, shared_homing_deque_enabled, i, homing_bullet_pos, homing_target_pos);
+				try_to_emit_bullet_homing_target_reached_signal(shared_homing_deque, shared_homing_deque_enabled, i, homing_bullet_pos, homing_target_pos, commands);
 				direction_got_updated = true;
 				target_deque_used_for_orbiting = &shared_homing_deque;
-			} else if (is_per_bullet_homing_enabled) { // Handle per-bullet homing
-				// Whether the deque has any targets
-				auto &curr_homing_count = all_homing_count[i];
-
-				if (curr_homing_count > 0) {
-					auto &curr_homing_deque = all_bullet_homing_targets[i];
-
-					// Trim the invalid ones
-					int trimmed_count = curr_homing_deque.bullet_homing_trim_front_invalid_targets(cached_mouse_global_position, curr_homing_count);
-
-					// Very important to keep track of the amount of targets after trimming
-					curr_homing_count -= trimmed_count; // count for the deque
-					active_homing_count -= trimmed_count; // global count across all bullets that determines whether the per-bullet homing feature is even active
-
-					if (curr_homing_count > 0) {
-						// If per bullet homing is indeed active, then refresh the cache if interval has been reached
-						if (homing_interval_reached) {
-							curr_homing_deque.refresh_cached_front_target_global_position(cached_mouse_global_position);
-						}
+			} else if (is_per_bullet_homing_enabled && all_homing_count[i] > 0) { // Handle per-bullet homing (the freed targets were already trimmed and the cached positions refreshed by prepare_simulation_frame)
+				auto &curr_homing_deque = all_bullet_homing_targets[i];
 
-						update_homing(curr_homing_deque, i, delta, homing_bullet_pos, homing_target_pos);
-						try_to_emit_bullet_homing_target_reached_signal(curr_homing_deque, shared_homing_deque_enabled, i, homing_bullet_pos, homing_target_pos);
-						direction_got_updated = true;
-						target_deque_used_for_orbiting = &curr_homing_deque;
-					}
-				}
+				update_homing(curr_homing_deque, i, delta, homing_bullet_pos, homing_target_pos);
+				try_to_emit_bullet_homing_target_reached_signal(curr_homing_deque, shared_homing_deque_enabled, i, homing_bullet_pos, homing_target_pos, commands);
+				direction_got_updated = true;
+				target_deque_used_for_orbiting = &curr_homing_deque;
 			}
 
 			auto &curr_bullet_transf = all_cached_instance_transforms[i];
 			auto &curr_bullet_direction = all_cached_direction[i];
 
 			// 2. DIRECTION CURVES
-			if (shared_curves_data_enabled) {
+			if constexpr (!use_curves) {
+				// Curves are compiled out
+			} else if (shared_curves_data_enabled) {
 				if (shared_curves_x_direction_curve_valid) {
-					apply_x_direction_curve(curr_bullet_direction, shared_curves_ptr);
+					apply_x_direction_curve_offset(curr_bullet_direction, shared_curves_x_direction_offset, shared_curves_ptr);
 				}
 
 				if (shared_curves_y_direction_curve_valid) {
-					apply_y_direction_curve(curr_bullet_direction, shared_curves_ptr);
+					apply_y_direction_curve_offset(curr_bullet_direction, shared_curves_y_direction_offset, shared_curves_ptr);
 				}
 
 				if (shared_curves_x_direction_curve_valid || shared_curves_y_direction_curve_valid) {
@@ -212,12 +467,10 @@ public:
 					direction_got_updated = true;
 				}
 			} else {
-				per_bullet_curves_data = find_bullet_curves_data(i); // TODO this uses unordered map, future version should improve it
+				per_bullet_curves_data = find_bullet_curves_data(i);
 				is_per_bullet_curves_valid = per_bullet_curves_data != nullptr;
 
 				if (is_per_bullet_curves_valid) {
-					per_bullet_curves_data = all_bullet_curves_data[i].ptr();
-
 					const bool per_bullet_x_curve_valid = per_bullet_curves_data->x_direction_curve.is_valid();
 					const bool per_bullet_y_curve_valid = per_bullet_curves_data->y_direction_curve.is_valid();
 
@@ -239,17 +492,17 @@ public:
 			// 3. ROTATION
 			if (shared_curves_rotation_curve_valid) {
 				update_rotation_using_curve(i, delta);
-				bullet_accelerate_rotation_speed_using_curve(i, delta, shared_curves_ptr);
+				all_rotation_speed[i] = shared_curves_rotation_speed;
 			} else if (is_per_bullet_curves_valid && per_bullet_curves_data->rotation_speed_curve.is_valid()) {
 				update_rotation_using_curve(i, delta);
 				bullet_accelerate_rotation_speed_using_curve(i, delta, per_bullet_curves_data);
-			} else if (is_rotation_data_active) {
+			} else if (is_rotation_enabled) {
 				update_rotation(i, delta);
 				bullet_accelerate_rotation_speed(i, delta);
 			}
 
 			// 4. ADJUST DIRECTION BASED ON THE NEW ROTATION (OPTIONALLY)
-			if (adjust_direction_based_on_rotation) {
+			if (use_adjust_direction && adjust_direction_based_on_rotation) {
 				curr_bullet_direction = all_cached_instance_transforms[i].columns[0].normalized();
 				direction_got_updated = true;
 			}
@@ -262,23 +515,21 @@ public:
 			velocity_delta *= delta;
 
 			// 6. MOVEMENT PATTERNS (RELYING ON CURVES AND PATH2D)
-			const bool use_pattern = check_exists_bullet_movement_pattern_data(i); // TODO this uses unordered map, future version should improve it
-			if (use_pattern) {
-				auto &pattern = all_movement_pattern_data[i];
-				const Ref<Curve2D> &curve = pattern.path_curve;
-				const real_t len = curve->get_baked_length();
+			BulletMovementPatternData2D *pattern_ptr = nullptr;
+			if constexpr (use_movement_patterns) {
+				pattern_ptr = all_movement_pattern_data.find(i);
+			}
+			if (pattern_ptr != nullptr && pattern_ptr->path->length > 0.0) {
+				auto &pattern = *pattern_ptr;
+				const BulletMovementPatternPath2D *path = pattern.path.ptr();
+				const real_t len = path->length;
 				const real_t prev_dist = pattern.distance_traveled;
 				const real_t advance_dist = velocity_delta.length();
 				pattern.distance_traveled += advance_dist;
-				const real_t s1 = Math::fmod(prev_dist, len);
-				const real_t s2 = Math::fmod(pattern.distance_traveled, len);
-				const int64_t l1 = (int64_t)(prev_dist / len);
-				const int64_t l2 = (int64_t)(pattern.distance_traveled / len);
-				const Vector2 start = curve->sample_baked(0.0);
-				const Vector2 end = curve->sample_baked(len * 0.9999);
-				const Vector2 disp = end - start;
-				const Vector2 p1 = l1 * disp + (curve->sample_baked(s1) - start);
-				const Vector2 p2 = l2 * disp + (curve->sample_baked(s2) - start);
+
+				// The arc-length data of the curve is baked once and shared, so this is just two indexed lerps
+				const Vector2 p1 = path->sample_repeating(prev_dist);
+				const Vector2 p2 = path->sample_repeating(pattern.distance_traveled);
 				Vector2 local_delta = p2 - p1;
 				Vector2 pattern_direction = local_delta.rotated(curr_bullet_direction.angle()).normalized();
 				const real_t original_speed = velocity_delta.length();
@@ -296,7 +547,12 @@ public:
 						curr_bullet_transf.columns[0] = logical_dir;
 						curr_bullet_transf.columns[1] = Vector2(-logical_dir.y, logical_dir.x);
 					}
-					all_movement_pattern_data.erase(i);
+					// pattern is no longer valid after this
+					if (commands != nullptr) {
+						commands->bullets_with_finished_movement_patterns.emplace_back(i);
+					} else {
+						all_movement_pattern_data.erase(i);
+					}
 				}
 			}
 
@@ -379,19 +635,21 @@ public:
 			curr_bullet_origin += velocity_delta;
 			curr_bullet_transf.set_origin(curr_bullet_origin);
 
-			auto &curr_shape_transf = all_cached_shape_transforms[i];
+			// The shape transform always follows the bullet transform, so if the shape didn't change neither did the bullet
 			auto &curr_shape_origin = all_cached_shape_origin[i];
-			curr_shape_transf = curr_bullet_transf;
-			Vector2 rotated_offset = cache_collision_shape_offset.rotated(curr_shape_transf.get_rotation());
+			Transform2D new_shape_transf = curr_bullet_transf;
+			Vector2 rotated_offset = cache_collision_shape_offset.rotated(new_shape_transf.get_rotation());
 			curr_shape_origin = curr_bullet_origin + rotated_offset;
-			curr_shape_transf.set_origin(curr_shape_origin);
+			new_shape_transf.set_origin(curr_shape_origin);
+
+			const bool has_bullet_moved = sync_shape_transform_if_changed(i, new_shape_transf, worker_thread_range);
+			have_any_bullets_moved |= has_bullet_moved;
 
-			physics_server->area_set_shape_transform(area, i, curr_shape_transf);
-			move_bullet_attachment(velocity_delta, i);
+			move_bullet_attachment(velocity_delta, i, is_on_worker_thread);
 
 			// 9. MOVEMENT SPEED ACCELERATION
 			if (shared_curves_acceleration_curve_valid) {
-				bullet_accelerate_speed_using_curve(i, delta, shared_curves_ptr);
+				bullet_set_speed_from_curve(i, shared_curves_movement_speed);
 			} else if (is_per_bullet_curves_valid && per_bullet_curves_data->movement_speed_curve.is_valid()) {
 				bullet_accelerate_speed_using_curve(i, delta, per_bullet_curves_data);
 			} else {
@@ -399,18 +657,129 @@ public:
 			}
 
 			// 10. IF NOT USING PHYSICS INTERPOLATION, APPLY THE TRANSFORM TO THE TEXTURE NOW IN THIS PHYSICS FRAME
-			if (!is_using_physics_interpolation) {
-				multi->set_instance_transform_2d(i, all_cached_instance_transforms[i]);
+			if (!is_using_physics_interpolation && has_bullet_moved) {
+				write_instance_buffer_transform(instance_buffer_ptr, i, all_cached_instance_transforms[i]);
 			}
 		}
 
-		// Handle collisions safely after all physics processing logic is done
-		for (auto &data : all_collided_bullets) {
-			handle_bullet_collision(data.collision_type, data.bullet_index, data.collided_instance_id);
+		return have_any_bullets_moved;
+	}
+
+	// The structure-of-arrays copy of the active bullets used by simulate_bullets_straight_line
+	BulletSoaState2D straight_line_state;
+
+	// Moves the active bullets from active_index_begin up to (but not including) active_index_end in a straight line while accelerating them and optionally rotates all of them by the same angle. Same result as simulate_bullets_loop, but the speed, velocity, origin and rotation math is done by the SIMD kernels: the bullets are gathered into straight_line_state, moved by the kernels and scattered back. Only valid when no other movement feature (homing, curves, movement patterns, per-bullet rotation) is used. Returns whether any of the bullets moved
+	_ALWAYS_INLINE_ bool simulate_bullets_straight_line(const SimulationFrameData &frame, int active_index_begin, int active_index_end, WorkerThreadRange *worker_thread_range) {
+		const bool is_on_worker_thread = worker_thread_range != nullptr;
+		const bool is_using_physics_interpolation = frame.is_using_physics_interpolation;
+		const real_t delta_real = static_cast<real_t>(frame.delta);
+		const real_t rotation_angle = frame.straight_line_rotation_angle;
+		const bool is_rotating = rotation_angle != 0.0;
+
+		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
+		BulletSoaState2D &soa = straight_line_state;
+
+		// Ranges start at a multiple of the padding, so the slots of this range begin aligned. Only the last range runs into the padding
+		const int amount_padded = BulletSimdKernels::pad_amount(active_index_end - active_index_begin);
+
+		// 1. GATHER THE ACTIVE BULLETS
+		for (int k = active_index_begin; k < active_index_end; ++k) {
+			const int i = active_bullet_indexes[k];
+
+			const Vector2 &origin = all_cached_instance_origin[i];
+			soa.x[k] = origin.x;
+			soa.y[k] = origin.y;
+
+			const Vector2 &velocity = all_cached_velocity[i];
+			soa.velocity_x[k] = velocity.x;
+			soa.velocity_y[k] = velocity.y;
+
+			const Vector2 &direction = all_cached_direction[i];
+			soa.direction_x[k] = direction.x;
+			soa.direction_y[k] = direction.y;
+
+			soa.speed[k] = all_cached_speed[i];
+			soa.max_speed[k] = all_cached_max_speed[i];
+			soa.acceleration[k] = all_cached_acceleration[i];
+
+			if (is_rotating) {
+				const Transform2D &transf = all_cached_instance_transforms[i];
+				soa.cos[k] = transf.columns[0].x;
+				soa.sin[k] = transf.columns[0].y;
+				soa.y_axis_x[k] = transf.columns[1].x;
+				soa.y_axis_y[k] = transf.columns[1].y;
+			}
 		}
-		all_collided_bullets.clear();
+
+		// 2. MOVE THE ORIGINS USING THE VELOCITY FROM THE PREVIOUS PHYSICS FRAME
+		BulletSimdKernels::integrate(soa.x + active_index_begin, soa.velocity_x + active_index_begin, delta_real, amount_padded);
+		BulletSimdKernels::integrate(soa.y + active_index_begin, soa.velocity_y + active_index_begin, delta_real, amount_padded);
+
+		// 3. MOVEMENT SPEED ACCELERATION
+		BulletSimdKernels::accelerate_speeds(soa.speed + active_index_begin, soa.acceleration + active_index_begin, soa.max_speed + active_index_begin, delta_real, amount_padded);
+		BulletSimdKernels::calculate_velocities(soa.velocity_x + active_index_begin, soa.direction_x + active_index_begin, soa.speed + active_index_begin, inherited_velocity_offset.x, amount_padded);
+		BulletSimdKernels::calculate_velocities(soa.velocity_y + active_index_begin, soa.direction_y + active_index_begin, soa.speed + active_index_begin, inherited_velocity_offset.y, amount_padded);
+
+		// 4. CONSTANT ROTATION (THE DIRECTION IS NOT ADJUSTED, SO THE VELOCITIES STAY THE SAME)
+		if (is_rotating) {
+			const real_t sin_angle = Math::sin(rotation_angle);
+			const real_t cos_angle = Math::cos(rotation_angle);
+
+			BulletSimdKernels::rotate_vectors(soa.cos + active_index_begin, soa.sin + active_index_begin, sin_angle, cos_angle, amount_padded);
+			BulletSimdKernels::rotate_vectors(soa.y_axis_x + active_index_begin, soa.y_axis_y + active_index_begin, sin_angle, cos_angle, amount_padded);
+		}
+
+		// 5. SCATTER THE RESULTS BACK AND UPDATE THE TRANSFORMS
+		const bool has_collision_shape_offset = cache_collision_shape_offset != Vector2(0, 0);
+
+		float *instance_buffer_ptr = frame.instance_buffer_ptr;
+
+		bool have_any_bullets_moved = false;
+
+		for (int k = active_index_begin; k < active_index_end; ++k) {
+			const int i = active_bullet_indexes[k];
+
+			all_cached_speed[i] = soa.speed[k];
+			all_cached_velocity[i] = Vector2(soa.velocity_x[k], soa.velocity_y[k]);
+
+			auto &curr_bullet_origin = all_cached_instance_origin[i];
+			const Vector2 new_origin(soa.x[k], soa.y[k]);
+
+			// How much the bullet moved (needed by the attachments)
+			const Vector2 velocity_delta = new_origin - curr_bullet_origin;
+
+			// A bullet that didn't rotate and didn't change its origin (a stationary one) has nothing to sync
+			if (!is_rotating && velocity_delta == Vector2(0, 0)) {
+				continue;
+			}
+
+			have_any_bullets_moved = true;
+			curr_bullet_origin = new_origin;
+
+			auto &curr_bullet_transf = all_cached_instance_transforms[i];
+			if (is_rotating) {
+				curr_bullet_transf.columns[0] = Vector2(soa.cos[k], soa.sin[k]);
+				curr_bullet_transf.columns[1] = Vector2(soa.y_axis_x[k], soa.y_axis_y[k]);
+			}
+			curr_bullet_transf.set_origin(curr_bullet_origin);
+
+			auto &curr_shape_origin = all_cached_shape_origin[i];
+			Transform2D new_shape_transf = curr_bullet_transf;
+			curr_shape_origin = has_collision_shape_offset ? curr_bullet_origin + cache_collision_shape_offset.rotated(new_shape_transf.get_rotation()) : curr_bullet_origin;
+			new_shape_transf.set_origin(curr_shape_origin);
+
+			sync_shape_transform_if_changed(i, new_shape_transf, worker_thread_range);
+			move_bullet_attachment(velocity_delta, i, is_on_worker_thread);
+
+			if (!is_using_physics_interpolation) {
+				write_instance_buffer_transform(instance_buffer_ptr, i, curr_bullet_transf);
+			}
+		}
+
+		return have_any_bullets_moved;
 	}
 
+public:
 	///////////////// ORBITING DATA METHODS
 
 	_ALWAYS_INLINE_ void bullet_enable_orbiting(int bullet_index, real_t orbiting_radius, OrbitingDirection orbiting_direction, OrbitingTextureRotation orbiting_texture_rotation) {
@@ -636,7 +1005,7 @@ public:
 		}
 
 		if (HomingTargetDeque::mouse_homing_targets_amount <= 0) {
-			cached_mouse_global_position = get_global_mouse_position();
+			cached_mouse_global_position = bullet_factory->get_global_mouse_position();
 		}
 
 		auto &queue = all_bullet_homing_targets[bullet_index];
@@ -683,7 +1052,7 @@ public:
 		}
 
 		if (HomingTargetDeque::mouse_homing_targets_amount <= 0) {
-			cached_mouse_global_position = get_global_mouse_position();
+			cached_mouse_global_position = bullet_factory->get_global_mouse_position();
 		}
 
 		auto &queue = all_bullet_homing_targets[bullet_index];
@@ -841,7 +1210,7 @@ public:
 		ensure_indexes_match_amount_bullets_range(bullet_index_start, bullet_index_end_inclusive, "all_bullets_replace_homing_targets_with_mouse");
 
 		// Cache once for the whole loop
-		cached_mouse_global_position = get_global_mouse_position();
+		cached_mouse_global_position = bullet_factory->get_global_mouse_position();
 
 		all_bullets_clear_homing_targets(bullet_index_start, bullet_index_end_inclusive);
 		for (int i = bullet_index_start; i <= bullet_index_end_inclusive; ++i) {
@@ -910,7 +1279,7 @@ public:
 
 	_ALWAYS_INLINE_ void shared_homing_deque_push_front_mouse_position_target() {
 		if (HomingTargetDeque::mouse_homing_targets_amount <= 0) {
-			cached_mouse_global_position = get_global_mouse_position();
+			cached_mouse_global_position = bullet_factory->get_global_mouse_position();
 		}
 
 		shared_homing_deque.push_front_mouse_position_target(cached_mouse_global_position);
@@ -926,7 +1295,7 @@ public:
 
 	_ALWAYS_INLINE_ void shared_homing_deque_push_back_mouse_position_target() {
 		if (HomingTargetDeque::mouse_homing_targets_amount <= 0) {
-			cached_mouse_global_position = get_global_mouse_position();
+			cached_mouse_global_position = bullet_factory->get_global_mouse_position();
 		}
 
 		shared_homing_deque.push_back_mouse_position_target(cached_mouse_global_position);
@@ -1053,7 +1422,7 @@ public:
 
 		// Instantly apply the updated transforms
 		if (all_bullets_enabled_set.contains(bullet_index)) { // Apply to multi only if the bullet is enabled (if disabled the transform is zero which prevents the multimesh from rendering it)
-			multi->set_instance_transform_2d(bullet_index, curr_bullet_transf);
+			set_instance_buffer_transform(bullet_index, curr_bullet_transf);
 		}
 
 		physics_server->area_set_shape_transform(area, bullet_index, curr_shape_transf);
@@ -1111,7 +1480,7 @@ public:
 
 		// Instantly apply the updated transforms
 		if (all_bullets_enabled_set.contains(bullet_index)) { // Apply to multi only if the bullet is enabled (if disabled the transform is zero which prevents the multimesh from rendering it)
-			multi->set_instance_transform_2d(bullet_index, curr_bullet_transf);
+			set_instance_buffer_transform(bullet_index, curr_bullet_transf);
 		}
 
 		physics_server->area_set_shape_transform(area, bullet_index, curr_shape_transf);
@@ -1160,6 +1529,24 @@ public:
 
 	// Virtual methods
 	void set_up_movement_data(const TypedArray<BulletSpeedData2D> &new_speed_data);
+
+	// Sets up the movement of a single emitted bullet. The bullet's transforms have to be set up already
+	void set_up_emitted_bullet_movement(int bullet_index, const CompiledBulletSpeedData2D &speed_data);
+
+	// Same as above, but for compiled spawn data
+	void set_up_movement_data(const std::vector<CompiledBulletSpeedData2D> &new_speed_data);
+
+	// Picks the compiled speed data if the bullets are being set up from the compiled arrays
+	void set_up_movement_data(const DirectionalBulletsData2D &data);
+
+	// EMITTER
+
+	// Emits a single bullet into a free slot of the emitter. If the life time is bigger than 0 the bullet gets its own lifetime. Returns the bullet index or -1 if the emitter is full
+	int emit_bullet(const Transform2D &transform, real_t speed, real_t max_speed, real_t acceleration = 0.0, double life_time = 0.0);
+
+	// Emits the bullets of a compiled template (placed relative to the origin, rotated by the rotation) into free slots of the emitter. Bullets that don't fit are not emitted. Returns the amount of emitted bullets
+	int emit_bullets_from_template(const Ref<DirectionalBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians = 0.0, double life_time = 0.0);
+
 	virtual void custom_additional_spawn_logic(const MultiMeshBulletsData2D &data) override final;
 	virtual void custom_additional_enable_logic(const MultiMeshBulletsData2D &data) override final;
 	virtual void custom_additional_disable_logic() override final;
@@ -1258,51 +1645,70 @@ protected:
 		rotate_transform_locally(all_cached_instance_transforms[bullet_index], rot_delta);
 	}
 
-	_ALWAYS_INLINE_ void try_to_emit_bullet_homing_target_reached_signal(HomingTargetDeque &homing_deque, bool is_using_shared_homing_deque, int bullet_index, const Vector2 &bullet_pos, const Vector2 &target_pos) {
+	// Checks whether the bullet reached its homing target. On a worker thread (commands is not nullptr) the signal is only queued and gets emitted by apply_worker_thread_simulation_results
+	_ALWAYS_INLINE_ void try_to_emit_bullet_homing_target_reached_signal(HomingTargetDeque &homing_deque, bool is_using_shared_homing_deque, int bullet_index, const Vector2 &bullet_pos, const Vector2 &target_pos, WorkerThreadRangeCommands *commands) {
 		// Reached check: Post-move, direct to actual target
 		Vector2 post_to_target = target_pos - bullet_pos;
 		real_t post_dist_sq = post_to_target.length_squared();
 		real_t threshold_sq = homing_distance_before_reached * homing_distance_before_reached;
-		if (post_dist_sq <= threshold_sq) { // Fully squared for perf
-
-			HomingTarget &target = homing_deque.front();
-
-			// Ensure that the signal is emitted only ONCE when the target is reached by the bullet
-			if (!target.has_bullet_reached_target) {
-				target.has_bullet_reached_target = true;
-				switch (target.type) {
-					case GlobalPositionTarget:
-						call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, nullptr, target_pos);
-						break;
-					case Node2DTarget: {
-						auto &target_data = target.node2d_target_data;
-
-						// In case the target instance is freed - will still emit the signal, but with a nullptr as the target
-						if (!homing_deque.is_homing_target_valid(target_data.target, target_data.cached_valid_instance_id)) {
-							call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, nullptr, target_pos);
-							break;
-						}
+		if (post_dist_sq > threshold_sq) { // Fully squared for perf
+			return;
+		}
 
-						call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, target_data.target, target_pos);
-						break;
-					}
-					case NotHoming:
-						break;
-					case MousePositionTarget:
-						call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, nullptr, target_pos);
-						break;
-				}
+		// The flag only changes on the main thread, so reading it here is safe even on a worker thread
+		if (homing_deque.front().has_bullet_reached_target) {
+			return;
+		}
 
-				// Pop the front target automatically if that's what the user wants
-				if (is_using_shared_homing_deque) {
-					if (shared_homing_deque_auto_pop_after_target_reached) {
-						call_deferred("shared_homing_deque_pop_front_target");
-					}
-				} else {
-					if (bullet_homing_auto_pop_after_target_reached) {
-						call_deferred("bullet_homing_pop_front_target", bullet_index);
-					}
+		if (commands != nullptr) {
+			commands->homing_targets_reached.emplace_back(bullet_index, target_pos);
+			return;
+		}
+
+		handle_homing_target_reached(homing_deque, is_using_shared_homing_deque, bullet_index, target_pos);
+	}
+
+	// Emits the bullet_homing_target_reached signal and pops the target if that's what the user wants. Always runs on the main thread
+	_ALWAYS_INLINE_ void handle_homing_target_reached(HomingTargetDeque &homing_deque, bool is_using_shared_homing_deque, int bullet_index, const Vector2 &target_pos) {
+		HomingTarget &target = homing_deque.front();
+
+		// Ensure that the signal is emitted only ONCE when the target is reached by the bullet (multiple ranges can queue the same shared target)
+		if (target.has_bullet_reached_target) {
+			return;
+		}
+
+		target.has_bullet_reached_target = true;
+		switch (target.type) {
+			case GlobalPositionTarget:
+				call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, nullptr, target_pos);
+				break;
+			case Node2DTarget: {
+				auto &target_data = target.node2d_target_data;
+
+				// In case the target instance is freed - will still emit the signal, but with a nullptr as the target
+				if (!homing_deque.is_homing_target_valid(target_data.target, target_data.cached_valid_instance_id)) {
+					call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, nullptr, target_pos);
+					break;
 				}
+
+				call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, target_data.target, target_pos);
+				break;
+			}
+			case NotHoming:
+				break;
+			case MousePositionTarget:
+				call_deferred("emit_signal", "bullet_homing_target_reached", this, bullet_index, nullptr, target_pos);
+				break;
+		}
+
+		// Pop the front target automatically if that's what the user wants
+		if (is_using_shared_homing_deque) {
+			if (shared_homing_deque_auto_pop_after_target_reached) {
+				call_deferred("shared_homing_deque_pop_front_target");
+			}
+		} else {
+			if (bullet_homing_auto_pop_after_target_reached) {
+				call_deferred("bullet_homing_pop_front_target", bullet_index);
 			}
 		}
 	}
@@ -17,6 +17,7 @@
 #include <godot_cpp/classes/scene_state.hpp>
 #include <godot_cpp/classes/shader_material.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <algorithm>
 
 using namespace godot;
 
@@ -46,9 +47,11 @@ void MultiMeshBullets2D::_notification(int p_what) {
 			}
 
 			// Disable the area's shapes (ALL OF THEM no matter their bullets_enabled_status)
-			for (int i = 0; i < amount_bullets; ++i) {
+			for (int i = 0; i < amount_bullets_capacity; ++i) {
 				physics_server->area_set_shape_disabled(area, i, true);
+			}
 
+			for (int i = 0; i < amount_bullets; ++i) {
 				bullet_disable_attachment(i);
 			}
 
@@ -56,11 +59,27 @@ void MultiMeshBullets2D::_notification(int p_what) {
 			physics_server->area_set_monitor_callback(area, Variant());
 
 			// Avoid memory leaks if you've used the PhysicsServer2D to generate area and shapes
-			for (auto &shape : physics_shapes) {
-				physics_server->free_rid(shape);
+			physics_server->free_rid(area);
+
+			// Nothing else owns the canvas item, since the multimesh is not a node
+			if (bullets_container != nullptr) {
+				bullets_container->remove_multimesh(*this);
 			}
 
-			physics_server->free_rid(area);
+			if (canvas_item.is_valid()) {
+				rendering_server->free_rid(canvas_item);
+			}
+
+			// The shape and the mesh are shared with other multimeshes, so they only get freed once nothing uses them
+			if (bullet_factory != nullptr) {
+				if (physics_shape.is_valid()) {
+					bullet_factory->shared_resources_cache.release_rectangle_shape(physics_shape_size);
+				}
+
+				if (is_using_shared_quad_mesh) {
+					bullet_factory->shared_resources_cache.release_quad_mesh(texture_size);
+				}
+			}
 		} break;
 	}
 }
@@ -78,19 +97,28 @@ int MultiMeshBullets2D::get_amount_active_attachments() const {
 }
 
 // Used to spawn brand new bullets.
-void MultiMeshBullets2D::spawn(const MultiMeshBulletsData2D &data, MultiMeshObjectPool *pool, BulletFactory2D *factory, Node *bullets_container, const Vector2 &new_inherited_velocity_offset, int new_sparse_set_id, bool spawn_in_pool) {
-	this->set_physics_interpolation_mode(Node::PHYSICS_INTERPOLATION_MODE_OFF); // We have custom physics interpolation logic, so disable the Godot one that comes from Godot 4.5
-
+void MultiMeshBullets2D::spawn(const MultiMeshBulletsData2D &data, MultiMeshObjectPool *pool, BulletFactory2D *factory, BulletsContainer2D &new_bullets_container, const Vector2 &new_inherited_velocity_offset, int new_sparse_set_id, bool spawn_in_pool, int new_amount_bullets_capacity, const Transform2D &new_spawn_origin, bool use_compiled_data) {
 	sparse_set_id = new_sparse_set_id;
 	inherited_velocity_offset = new_inherited_velocity_offset;
+	spawn_origin = new_spawn_origin;
+	is_using_compiled_data = use_compiled_data;
 
 	bullets_pool = pool;
 	bullet_factory = factory;
 	physics_server = PhysicsServer2D::get_singleton();
+	rendering_server = RenderingServer::get_singleton();
 
-	amount_bullets = data.transforms.size(); // important, because some set_up methods use this
+	// Has to exist before the multimesh can be drawn or set up
+	canvas_item = rendering_server->canvas_item_create();
 
-	all_bullets_enabled_set.resize(amount_bullets);
+	amount_bullets = data.get_amount_bullets_to_spawn(is_using_compiled_data); // important, because some set_up methods use this
+	amount_bullets_capacity = Math::max(amount_bullets, new_amount_bullets_capacity);
+
+	// Everything that is indexed by bullet index is sized by the capacity, so that the multimesh can later be re-used for any amount of bullets that fits
+	all_bullets_enabled_set.resize(amount_bullets_capacity);
+	all_bullet_curves_data.resize(amount_bullets_capacity);
+	all_movement_pattern_data.resize(amount_bullets_capacity);
+	bullet_expiry_wheel.resize(amount_bullets_capacity);
 
 	set_up_life_time_timer(data.max_life_time, data.max_life_time);
 	set_up_change_texture_timer(
@@ -99,31 +127,43 @@ void MultiMeshBullets2D::spawn(const MultiMeshBulletsData2D &data, MultiMeshObje
 			data.change_texture_times);
 
 	generate_multimesh();
-	set_up_multimesh(amount_bullets, data.mesh, data.texture_size);
+	set_up_multimesh(amount_bullets_capacity, data.mesh, data.texture_size);
+
+	// Has to exist before the area can report any collisions
+	collision_inbox.reset(Math::max(amount_bullets_capacity * COLLISION_INBOX_SLOTS_PER_BULLET, 64));
 
 	area = physics_server->area_create();
-	generate_physics_shapes_for_area(amount_bullets);
+	generate_physics_shapes_for_area(amount_bullets_capacity, data.collision_shape_size);
+
+	// The collision shapes of the unused capacity never collide
+	for (int i = amount_bullets; i < amount_bullets_capacity; ++i) {
+		physics_server->area_set_shape_disabled(area, i, true);
+	}
 
 	set_up_bullet_instances(data);
 
 	// Set up bullet attachments so that for every bullet you will be able to have an attachment if needed
 
-	attachment_pooling_ids.resize(amount_bullets, 0);
+	attachment_pooling_ids.resize(amount_bullets_capacity, 0);
 
-	attachments.resize(amount_bullets, nullptr);
+	attachments.resize(amount_bullets_capacity, nullptr);
 
-	attachment_transforms.resize(amount_bullets, Transform2D());
+	attachment_transforms.resize(amount_bullets_capacity, Transform2D());
 
-	attachment_offsets.resize(amount_bullets, Vector2());
+	attachment_offsets.resize(amount_bullets_capacity, Vector2());
 
-	attachment_local_transforms.resize(amount_bullets, Transform2D());
+	attachment_local_transforms.resize(amount_bullets_capacity, Transform2D());
 
-	attachment_stick_relative_to_bullet.resize(amount_bullets, 1);
+	attachment_stick_relative_to_bullet.resize(amount_bullets_capacity, 1);
 
-	set_rotation_data(data.all_bullet_rotation_data, data.rotate_only_textures);
+	if (is_using_compiled_data) {
+		set_rotation_data(data.compiled_rotation_data, data.rotate_only_textures);
+	} else {
+		set_rotation_data(data.all_bullet_rotation_data, data.rotate_only_textures);
+	}
 
-	all_previous_instance_transf.resize(amount_bullets);
-	all_previous_attachment_transf.resize(amount_bullets);
+	all_previous_instance_transf.resize(amount_bullets_capacity);
+	all_previous_attachment_transf.resize(amount_bullets_capacity);
 
 	update_all_previous_transforms_for_interpolation();
 
@@ -140,25 +180,34 @@ void MultiMeshBullets2D::spawn(const MultiMeshBulletsData2D &data, MultiMeshObje
 
 	custom_additional_spawn_logic(data);
 
-	set_process(false);
-	set_physics_process(false);
+	bullets_container = &new_bullets_container;
 
 	if (spawn_in_pool) {
 		set_visible(false);
 		is_active = false;
 		set_all_physics_shapes_enabled_for_area(false);
-		bullets_container->add_child(this);
-		bullets_pool->push(this, amount_bullets);
+		bullets_container->add_multimesh(*this);
+		bullets_pool->push(this, amount_bullets_capacity);
 	} else {
-		all_bullets_enabled_set.activate_all_data();
+		all_bullets_enabled_set.activate_range_data(0, amount_bullets - 1);
 		is_active = true;
-		bullets_container->add_child(this);
+		bullets_container->add_multimesh(*this);
+		sync_instance_buffer();
 	}
 }
 
 // Activates the multimesh
-void MultiMeshBullets2D::enable_multimesh(const MultiMeshBulletsData2D &data, const Vector2 &new_inherited_velocity_offset) {
+void MultiMeshBullets2D::enable_multimesh(const MultiMeshBulletsData2D &data, const Vector2 &new_inherited_velocity_offset, const Transform2D &new_spawn_origin, bool use_compiled_data) {
 	inherited_velocity_offset = new_inherited_velocity_offset;
+	spawn_origin = new_spawn_origin;
+	is_using_compiled_data = use_compiled_data;
+
+	// The instance buffer holds the transforms of the previous bullets, so the interpolation has to run again
+	have_bullets_moved = true;
+	are_interpolated_transforms_settled = false;
+
+	// A multimesh from a bigger size class might be re-used, in which case only the first N bullets are used (the object pool never hands out a multimesh with less capacity)
+	amount_bullets = Math::min(data.get_amount_bullets_to_spawn(is_using_compiled_data), amount_bullets_capacity);
 
 	set_up_life_time_timer(data.max_life_time, data.max_life_time);
 	set_up_change_texture_timer(
@@ -166,14 +215,18 @@ void MultiMeshBullets2D::enable_multimesh(const MultiMeshBulletsData2D &data, co
 			data.default_change_texture_time,
 			data.change_texture_times);
 
-	set_up_multimesh(amount_bullets, data.mesh, data.texture_size);
+	set_up_multimesh(amount_bullets_capacity, data.mesh, data.texture_size);
 
 	set_up_bullet_instances(data);
 	set_all_physics_shapes_enabled_for_area(true);
 
-	set_rotation_data(data.all_bullet_rotation_data, data.rotate_only_textures);
+	if (is_using_compiled_data) {
+		set_rotation_data(data.compiled_rotation_data, data.rotate_only_textures);
+	} else {
+		set_rotation_data(data.all_bullet_rotation_data, data.rotate_only_textures);
+	}
 
-	move_to_front(); // Makes sure that the current old multimesh is displayed on top of the newer ones (act as if its the oldest sibling to emulate the behaviour of spawning a brand new multimesh / if I dont do this then the multimesh's instances will be displayed behind the newer ones)
+	bullets_container->move_to_front(*this); // Makes sure that the current old multimesh is displayed on top of the newer ones (emulates the behaviour of spawning a brand new multimesh / if I dont do this then the multimesh's instances will be displayed behind the newer ones)
 
 	update_all_previous_transforms_for_interpolation();
 
@@ -192,9 +245,11 @@ void MultiMeshBullets2D::enable_multimesh(const MultiMeshBulletsData2D &data, co
 
 	set_visible(true);
 
-	// Mark all bullets as enabled in the sparse set (amount_bullets never changes)
-	all_bullets_enabled_set.activate_all_data();
+	// Mark all used bullets as enabled in the sparse set (the unused capacity stays disabled)
+	all_bullets_enabled_set.activate_range_data(0, amount_bullets - 1);
 	is_active = true;
+
+	sync_instance_buffer();
 }
 
 void MultiMeshBullets2D::set_up_bullet_instances(const MultiMeshBulletsData2D &data) {
@@ -221,33 +276,39 @@ void MultiMeshBullets2D::set_up_bullet_instances(const MultiMeshBulletsData2D &d
 	stop_rotation_when_max_reached = data.stop_rotation_when_max_reached;
 
 	cache_collision_shape_offset = data.collision_shape_offset;
+	cache_collision_shape_size = data.collision_shape_size;
+
+	// A pooled multimesh keeps its shape as long as the collision shape size stays the same
+	if (physics_shape_size != data.collision_shape_size) {
+		set_physics_shape_size(data.collision_shape_size);
+	}
 
 	if (all_cached_instance_transforms.size() != 0) {
 		// If there was old data then we are currently trying to enable a bullets multimesh, so clear everything that is old
 		// Note: We never really resize any of these vectors, so capacity always stays the same and the object pooling logic also ensures of this, so no need to reserve different amount of space since it's always going to be the original capacity value/ no memory reallocations
-		// Note: This logic relies on the fact that we always enable multimesh bullets based on their original amount_bullets - that's how the object pooling logic works in order to re-use everything
+		// Note: The capacity never changes, so the amount of bullets is never more than what was reserved when the multimesh got spawned
 		all_cached_instance_transforms.clear();
 		all_cached_instance_origin.clear();
 		all_cached_shape_transforms.clear();
 		all_cached_shape_origin.clear();
 	} else {
 		// If there wasn't any old data, that means we are spawning a bullets multimesh, so we need to ensure that all data structures reserve needed memory at once
-		all_cached_instance_transforms.reserve(amount_bullets);
-		all_cached_instance_origin.reserve(amount_bullets);
-		all_cached_shape_transforms.reserve(amount_bullets);
-		all_cached_shape_origin.reserve(amount_bullets);
+		all_cached_instance_transforms.reserve(amount_bullets_capacity);
+		all_cached_instance_origin.reserve(amount_bullets_capacity);
+		all_cached_shape_transforms.reserve(amount_bullets_capacity);
+		all_cached_shape_origin.reserve(amount_bullets_capacity);
 	}
 
 	cache_texture_rotation_radians = data.texture_rotation_radians;
+	cache_is_texture_rotation_permanent = data.is_texture_rotation_permanent;
 	cache_texture_transforms.resize(amount_bullets);
 
 	for (int i = 0; i < amount_bullets; ++i) {
-		RID shape = physics_shapes[i];
-
-		const Transform2D &curr_data_transf = data.transforms[i];
+		// Compiled spawn data is already in native memory and can be placed anywhere through the spawn origin
+		const Transform2D curr_data_transf = is_using_compiled_data ? spawn_origin * data.compiled_transforms[i] : static_cast<Transform2D>(data.transforms[i]);
 
 		// Generates a collision shape transform for a particular bullet and attaches it to the area
-		Transform2D shape_transf = generate_collision_shape_transform_for_area(curr_data_transf, shape, data.collision_shape_size, data.collision_shape_offset, i);
+		Transform2D shape_transf = generate_collision_shape_transform_for_area(curr_data_transf, data.collision_shape_offset, i);
 
 		// Generates texture transform with correct rotation and sets it to the correct bullet on the multimesh
 		const Transform2D &texture_transf = generate_texture_transform(curr_data_transf, data.is_texture_rotation_permanent, cache_texture_rotation_radians, i);
@@ -263,30 +324,127 @@ void MultiMeshBullets2D::set_up_bullet_instances(const MultiMeshBulletsData2D &d
 	}
 }
 
+void MultiMeshBullets2D::set_up_emitter() {
+	is_emitter = true;
+	emitter_next_slot = 0;
+
+	// The emitter lives until it gets freed, only its bullets retire
+	is_life_time_infinite = true;
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		hide_instance_buffer_transform(i);
+	}
+
+	set_all_physics_shapes_enabled_for_area(false);
+
+	all_bullets_enabled_set.clear();
+	active_bullets_counter = 0;
+
+	sync_instance_buffer();
+}
+
+void MultiMeshBullets2D::set_up_emitted_bullet(int bullet_index, const Transform2D &transf) {
+	const Transform2D shape_transf = generate_collision_shape_transform_for_area(transf, cache_collision_shape_offset, bullet_index);
+	const Transform2D texture_transf = generate_texture_transform(transf, cache_is_texture_rotation_permanent, cache_texture_rotation_radians, bullet_index);
+
+	cache_texture_transforms[bullet_index] = texture_transf;
+
+	all_cached_instance_transforms[bullet_index] = texture_transf;
+	all_cached_instance_origin[bullet_index] = texture_transf.get_origin();
+
+	all_cached_shape_transforms[bullet_index] = shape_transf;
+	all_cached_shape_origin[bullet_index] = shape_transf.get_origin();
+
+	// The previous bullet in this slot might have had its own curves, movement pattern or lifetime
+	all_bullet_curves_data.erase(bullet_index);
+	all_movement_pattern_data.erase(bullet_index);
+	bullet_expiry_wheel.cancel(bullet_index);
+
+	update_bullet_previous_transform_for_interpolation(bullet_index);
+
+	// Attachments belong to the slot, not the emitted bullet, so they are not re-enabled
+	enable_bullet(bullet_index, 0, false);
+}
+
+void MultiMeshBullets2D::bullet_set_life_time(int bullet_index, double life_time) {
+	if (!validate_bullet_index(bullet_index, "bullet_set_life_time")) {
+		return;
+	}
+
+	if (life_time <= 0.0) {
+		UtilityFunctions::push_error("Error when trying to set the life time of a bullet. The life time has to be bigger than 0. Ignoring the request");
+		return;
+	}
+
+	bullet_expiry_wheel.schedule(bullet_index, life_time);
+}
+
+void MultiMeshBullets2D::bullet_clear_life_time(int bullet_index) {
+	if (!validate_bullet_index(bullet_index, "bullet_clear_life_time")) {
+		return;
+	}
+
+	bullet_expiry_wheel.cancel(bullet_index);
+}
+
+double MultiMeshBullets2D::bullet_get_life_time_left(int bullet_index) const {
+	if (!validate_bullet_index(bullet_index, "bullet_get_life_time_left")) {
+		return -1.0;
+	}
+
+	return bullet_expiry_wheel.get_life_time_left(bullet_index);
+}
+
 void MultiMeshBullets2D::generate_multimesh() {
     Ref<MultiMesh> new_multi;
     new_multi.instantiate();
 
 	multi = new_multi;
-	set_multimesh(multi);
+
+	// Same draw command as the one of a MultiMeshInstance2D without a texture. set_texture replaces it
+	rendering_server->canvas_item_add_multimesh(canvas_item, multi->get_rid(), RID());
 }
 
 void MultiMeshBullets2D::set_up_multimesh(int new_instance_count, const Ref<Mesh> &new_mesh, Vector2 new_texture_size) {
 	if (new_mesh.is_valid()) {
+		if (is_using_shared_quad_mesh) {
+			bullet_factory->shared_resources_cache.release_quad_mesh(texture_size);
+			is_using_shared_quad_mesh = false;
+		}
+
 		multi->set_mesh(new_mesh);
-	} else {
-		Ref<QuadMesh> mesh = memnew(QuadMesh);
-		mesh->set_size(new_texture_size);
-		multi->set_mesh(mesh);
+	} else if (!is_using_shared_quad_mesh || texture_size != new_texture_size) {
+		// Every multimesh with the same texture size shares a single QuadMesh, so a pooled multimesh that gets enabled with the same texture size doesn't touch its mesh at all
+		if (is_using_shared_quad_mesh) {
+			bullet_factory->shared_resources_cache.release_quad_mesh(texture_size);
+		}
+
+		multi->set_mesh(bullet_factory->shared_resources_cache.acquire_quad_mesh(new_texture_size));
+		is_using_shared_quad_mesh = true;
 		texture_size = new_texture_size;
 	}
 
-	multi->set_instance_count(new_instance_count);
+	// A pooled multimesh always keeps its capacity, so the instance data is only re-allocated on the rendering server when the multimesh gets spawned
+	if (multi->get_instance_count() != new_instance_count) {
+		multi->set_instance_count(new_instance_count);
+	}
+
+	// Don't even submit the unused capacity for drawing
+	const int new_visible_instance_count = amount_bullets < new_instance_count ? amount_bullets : -1;
+	if (multi->get_visible_instance_count() != new_visible_instance_count) {
+		multi->set_visible_instance_count(new_visible_instance_count);
+	}
+
+	// Setting the instance count clears the instance data on the rendering server side, so the buffer starts from zero as well (zero transform = the instance is not rendered). When the instance count didn't change, the old instance data gets overwritten by the next sync instead
+	instance_buffer.resize(new_instance_count * INSTANCE_BUFFER_STRIDE);
+	instance_buffer.fill(0.0f);
+	is_instance_buffer_dirty = true;
 }
 
 void MultiMeshBullets2D::set_up_life_time_timer(double new_max_life_time, double new_current_life_time) {
 	max_life_time = new_max_life_time;
 	current_life_time = new_current_life_time;
+	is_life_time_expiry_queued = false;
 }
 
 void MultiMeshBullets2D::set_up_change_texture_timer(int64_t new_amount_textures, double new_default_change_texture_time, const TypedArray<double> &new_change_texture_times) {
@@ -335,42 +493,75 @@ void MultiMeshBullets2D::finalize_set_up(
 		}
 		current_texture_index = new_current_texture_index;
 
-		set_texture(textures[current_texture_index]);
+		set_texture_if_changed(textures[current_texture_index]);
 	} else if (new_default_texture != nullptr) {
 		textures.append(new_default_texture);
 		current_texture_index = 0;
 
-		set_texture(textures[current_texture_index]);
+		set_texture_if_changed(textures[current_texture_index]);
 	}
 
+	// Every setter below ends up in the rendering server, so only the values that differ from what the multimesh already has are applied (a pooled multimesh that gets enabled with the same data doesn't issue any calls)
 	if (new_material.is_valid()) {
+		const bool is_material_changed = material != new_material;
+
 		godot::Ref<ShaderMaterial> shader_material = new_material;
 		// If a shader material was passed and the user has provided instance shader parameters
-		if (shader_material.is_valid() && new_instance_shader_parameters.is_empty() == false) {
-			instance_shader_parameters = new_instance_shader_parameters;
-
+		if (shader_material.is_valid() && new_instance_shader_parameters.is_empty() == false && (is_material_changed || instance_shader_parameters != new_instance_shader_parameters)) {
 			const Array &keys = new_instance_shader_parameters.keys();
 			for (int i = 0; i < keys.size(); ++i) {
 				const String &key = keys[i];
 				const Variant &value = new_instance_shader_parameters[key];
 
-				set_instance_shader_parameter(key, value);
+				if (is_material_changed || !instance_shader_parameters.has(key) || instance_shader_parameters[key] != value) {
+					rendering_server->canvas_item_set_instance_shader_parameter(canvas_item, key, value);
+				}
 			}
+
+			// Keep a copy, so that changes the user makes to the spawn data later on are detected
+			instance_shader_parameters = new_instance_shader_parameters.duplicate();
 		}
 
-		set_material(new_material);
-	} else {
-		set_material(nullptr);
+		if (is_material_changed) {
+			material = new_material;
+			rendering_server->canvas_item_set_material(canvas_item, material->get_rid());
+		}
+	} else if (material.is_valid()) {
+		material.unref();
+		rendering_server->canvas_item_set_material(canvas_item, RID());
 	}
 
 	// Z Index
-	set_z_index(new_z_index);
+	if (z_index != new_z_index) {
+		z_index = new_z_index;
+		rendering_server->canvas_item_set_z_index(canvas_item, z_index);
+	}
 
 	// Light mask
-	set_light_mask(new_light_mask);
+	if (light_mask != new_light_mask) {
+		light_mask = new_light_mask;
+		rendering_server->canvas_item_set_light_mask(canvas_item, light_mask);
+	}
 
 	// Visibility layer
-	set_visibility_layer(new_visibility_layer);
+	if (visibility_layer != static_cast<uint32_t>(new_visibility_layer)) {
+		visibility_layer = static_cast<uint32_t>(new_visibility_layer);
+		rendering_server->canvas_item_set_visibility_layer(canvas_item, visibility_layer);
+	}
+}
+
+void MultiMeshBullets2D::set_texture_if_changed(const Ref<Texture2D> &new_texture) {
+	if (texture != new_texture) {
+		set_texture(new_texture);
+	}
+}
+
+void MultiMeshBullets2D::set_texture(const Ref<Texture2D> &new_texture) {
+	texture = new_texture;
+
+	// The canvas item only ever holds the single draw command of the multimesh
+	rendering_server->canvas_item_clear(canvas_item);
+	rendering_server->canvas_item_add_multimesh(canvas_item, multi->get_rid(), texture.is_valid() ? texture->get_rid() : RID());
 }
 
 // OTHER
@@ -419,6 +610,32 @@ void MultiMeshBullets2D::set_rotation_data(const TypedArray<BulletRotationData2D
 	}
 }
 
+void MultiMeshBullets2D::set_rotation_data(const std::vector<CompiledBulletRotationData2D> &rotation_data, bool new_rotate_only_textures) {
+	const int amount_rotation_data = static_cast<int>(rotation_data.size());
+
+	// Same rules as the TypedArray version above
+	if (amount_rotation_data == 0) {
+		is_rotation_data_active = false;
+		return;
+	}
+
+	is_rotation_data_active = true;
+	use_only_first_rotation_data = amount_rotation_data != amount_bullets;
+	rotate_only_textures = new_rotate_only_textures;
+
+	all_rotation_speed.resize(amount_rotation_data);
+	all_max_rotation_speed.resize(amount_rotation_data);
+	all_rotation_acceleration.resize(amount_rotation_data);
+
+	for (int i = 0; i < amount_rotation_data; ++i) {
+		const CompiledBulletRotationData2D &curr_bullet_data = rotation_data[i];
+
+		all_rotation_speed[i] = curr_bullet_data.rotation_speed;
+		all_max_rotation_speed[i] = curr_bullet_data.max_rotation_speed;
+		all_rotation_acceleration[i] = curr_bullet_data.rotation_acceleration;
+	}
+}
+
 Transform2D MultiMeshBullets2D::generate_texture_transform(Transform2D transf, bool is_texture_rotation_permanent, real_t texture_rotation_radians, int bullet_index) {
 	if (is_texture_rotation_permanent) {
 		// Same texture rotation no matter the rotation of the bullet's transform
@@ -428,22 +645,63 @@ Transform2D MultiMeshBullets2D::generate_texture_transform(Transform2D transf, b
 		transf.set_rotation(transf.get_rotation() + texture_rotation_radians);
 	}
 
-	multi->set_instance_transform_2d(bullet_index, transf);
+	set_instance_buffer_transform(bullet_index, transf);
 
 	return transf;
 }
 
 void MultiMeshBullets2D::set_up_area(const int collision_layer, const int collision_mask, bool new_monitorable, const RID &physics_space) {
-	monitorable = new_monitorable;
-	physics_server->area_set_space(area, bullet_factory->physics_space);
-	physics_server->area_set_monitorable(area, monitorable);
-	physics_server->area_set_area_monitor_callback(area, callable_mp(this, &MultiMeshBullets2D::area_entered_func));
-	physics_server->area_set_monitor_callback(area, callable_mp(this, &MultiMeshBullets2D::body_entered_func));
-	physics_server->area_set_collision_layer(area, collision_layer);
-	physics_server->area_set_collision_mask(area, collision_mask);
+	// Bullets that use the collision grid keep their area outside of the physics space, so the physics server doesn't spend any time on them
+	is_using_collision_grid = bullet_factory->use_collision_grid;
+	const RID new_area_space = is_using_collision_grid ? RID() : physics_space;
+
+	// The monitor callbacks never change, so they are bound only once
+	if (!is_area_state_applied) {
+		physics_server->area_set_area_monitor_callback(area, callable_mp(this, &MultiMeshBullets2D::area_entered_func));
+		physics_server->area_set_monitor_callback(area, callable_mp(this, &MultiMeshBullets2D::body_entered_func));
+	}
+
+	// Re-enabling a pooled multimesh with the same collision settings doesn't touch the physics server at all
+	if (!is_area_state_applied || applied_area_space != new_area_space) {
+		physics_server->area_set_space(area, new_area_space);
+		applied_area_space = new_area_space;
+	}
+
+	if (!is_area_state_applied || monitorable != new_monitorable) {
+		physics_server->area_set_monitorable(area, new_monitorable);
+		monitorable = new_monitorable;
+	}
+
+	if (!is_area_state_applied || applied_collision_layer != collision_layer) {
+		physics_server->area_set_collision_layer(area, collision_layer);
+		applied_collision_layer = collision_layer;
+	}
+
+	if (!is_area_state_applied || applied_collision_mask != collision_mask) {
+		physics_server->area_set_collision_mask(area, collision_mask);
+		applied_collision_mask = collision_mask;
+	}
+
+	is_area_state_applied = true;
+}
+
+void MultiMeshBullets2D::stop_using_collision_grid(const RID &physics_space) {
+	if (!is_using_collision_grid) {
+		return;
+	}
+
+	is_using_collision_grid = false;
+
+	// The collision shapes were never moved on the physics server while the grid was used
+	for (int i : all_bullets_enabled_set.get_active_indexes()) {
+		set_shape_transform_for_area(i, all_cached_shape_transforms[i]);
+	}
+
+	physics_server->area_set_space(area, physics_space);
+	applied_area_space = physics_space;
 }
 
-Transform2D MultiMeshBullets2D::generate_collision_shape_transform_for_area(Transform2D transf, const RID &shape, const Vector2 &collision_shape_size, const Vector2 &collision_shape_offset, int bullet_index) {
+Transform2D MultiMeshBullets2D::generate_collision_shape_transform_for_area(Transform2D transf, const Vector2 &collision_shape_offset, int bullet_index) {
 	// The rotation of each transform
 	real_t curr_bullet_rotation = transf.get_rotation();
 
@@ -454,21 +712,37 @@ Transform2D MultiMeshBullets2D::generate_collision_shape_transform_for_area(Tran
 
 	transf.set_origin(transf.get_origin() + rotated_offset);
 
-	physics_server->area_set_shape_transform(area, bullet_index, transf);
-	physics_server->shape_set_data(shape, collision_shape_size / 2); // SHAPE_RECTANGLE: a Vector2 half_extents  (I'm dividing by 2 to get the actual size the user wants for the rectangle, the function wants half_extents, if it gets the size 32 for the x, that means only the half width is 32 so the other half will also be 32 meaning 64 total width if I give the user's 32 that he said, to avoid that im deviding by 2 so the size gets set correctly to 32)
+	// The collision grid reads the shape origins straight from the cache
+	if (!is_using_collision_grid) {
+		physics_server->area_set_shape_transform(area, bullet_index, transf);
+	}
 
 	return transf;
 }
 
-void MultiMeshBullets2D::generate_physics_shapes_for_area(int amount) {
-	physics_shapes.reserve(amount);
+void MultiMeshBullets2D::generate_physics_shapes_for_area(int amount, const Vector2 &collision_shape_size) {
+	// All bullets have the same collision shape size, so every shape of the area is the same shared rectangle shape
+	physics_shape = bullet_factory->shared_resources_cache.acquire_rectangle_shape(collision_shape_size);
+	physics_shape_size = collision_shape_size;
+
 	for (int i = 0; i < amount; ++i) {
-		RID shape = physics_server->rectangle_shape_create();
-		physics_server->area_add_shape(area, shape);
-		physics_shapes.emplace_back(shape);
+		physics_server->area_add_shape(area, physics_shape);
 	}
 }
 
+void MultiMeshBullets2D::set_physics_shape_size(const Vector2 &new_collision_shape_size) {
+	RID new_physics_shape = bullet_factory->shared_resources_cache.acquire_rectangle_shape(new_collision_shape_size);
+
+	for (int i = 0; i < amount_bullets_capacity; ++i) {
+		physics_server->area_set_shape(area, i, new_physics_shape);
+	}
+
+	bullet_factory->shared_resources_cache.release_rectangle_shape(physics_shape_size);
+
+	physics_shape = new_physics_shape;
+	physics_shape_size = new_collision_shape_size;
+}
+
 void MultiMeshBullets2D::set_all_physics_shapes_enabled_for_area(bool enable) {
 	for (int i = 0; i < amount_bullets; ++i) {
 		physics_server->area_set_shape_disabled(area, i, !enable);
@@ -598,6 +872,10 @@ void MultiMeshBullets2D::set_bullet_texture_rotation_radians(int bullet_index, r
 	auto &curr_transf = all_cached_instance_transforms[bullet_index];
 	curr_transf.set_rotation(new_rotation_radians);
 
+	if (all_bullets_enabled_set.contains(bullet_index)) {
+		set_instance_buffer_transform(bullet_index, curr_transf);
+	}
+
 	update_bullet_previous_transform_for_interpolation(bullet_index);
 }
 
@@ -636,6 +914,10 @@ void MultiMeshBullets2D::set_bullet_texture_rotation_degrees(int bullet_index, r
 	auto &curr_transf = all_cached_instance_transforms[bullet_index];
 	curr_transf.set_rotation(Math::deg_to_rad(new_rotation_degrees));
 
+	if (all_bullets_enabled_set.contains(bullet_index)) {
+		set_instance_buffer_transform(bullet_index, curr_transf);
+	}
+
 	update_bullet_previous_transform_for_interpolation(bullet_index);
 }
 
@@ -695,7 +977,7 @@ void MultiMeshBullets2D::set_bullet_transform(int bullet_index, const Transform2
 
 	// Instantly apply the updated transforms
 	if (all_bullets_enabled_set.contains(bullet_index)) { // Apply to multi only if the bullet is enabled (if disabled the transform is zero which prevents the multimesh from rendering it)
-		multi->set_instance_transform_2d(bullet_index, curr_bullet_transf);
+		set_instance_buffer_transform(bullet_index, curr_bullet_transf);
 	}
 
 	// Update direction if requested
@@ -704,7 +986,7 @@ void MultiMeshBullets2D::set_bullet_transform(int bullet_index, const Transform2
 		all_cached_direction[bullet_index] = new_direction.normalized();
 	}
 
-	physics_server->area_set_shape_transform(area, bullet_index, curr_shape_transf);
+	set_shape_transform_for_area(bullet_index, curr_shape_transf);
 
 	update_bullet_previous_transform_for_interpolation(bullet_index);
 }
@@ -728,6 +1010,138 @@ void MultiMeshBullets2D::all_bullets_set_transforms(const Transform2D &new_trans
 	}
 }
 
+PackedVector2Array MultiMeshBullets2D::all_bullets_get_positions_packed(int bullet_index_start, int bullet_index_end_inclusive) const {
+	ensure_indexes_match_amount_bullets_range(bullet_index_start, bullet_index_end_inclusive, "all_bullets_get_positions_packed");
+
+	PackedVector2Array arr;
+	arr.resize(bullet_index_end_inclusive - bullet_index_start + 1);
+	std::copy(all_cached_instance_origin.begin() + bullet_index_start, all_cached_instance_origin.begin() + bullet_index_end_inclusive + 1, arr.ptrw());
+
+	return arr;
+}
+
+void MultiMeshBullets2D::all_bullets_set_positions_packed(const PackedVector2Array &new_positions, int bullet_index_start) {
+	if (!validate_packed_values_range(bullet_index_start, new_positions.size(), "all_bullets_set_positions_packed")) {
+		return;
+	}
+
+	const Vector2 *positions = new_positions.ptr();
+	const int amount_values = static_cast<int>(new_positions.size());
+
+	for (int i = 0; i < amount_values; ++i) {
+		const int bullet_index = bullet_index_start + i;
+
+		// Only the position changes, the rotation and scale of the bullet are kept
+		Transform2D new_transform = all_cached_instance_transforms[bullet_index];
+		new_transform.set_origin(positions[i]);
+
+		set_bullet_transform(bullet_index, new_transform);
+	}
+}
+
+PackedVector2Array MultiMeshBullets2D::all_bullets_get_directions_packed(int bullet_index_start, int bullet_index_end_inclusive) const {
+	ensure_indexes_match_amount_bullets_range(bullet_index_start, bullet_index_end_inclusive, "all_bullets_get_directions_packed");
+
+	PackedVector2Array arr;
+	arr.resize(bullet_index_end_inclusive - bullet_index_start + 1);
+	std::copy(all_cached_direction.begin() + bullet_index_start, all_cached_direction.begin() + bullet_index_end_inclusive + 1, arr.ptrw());
+
+	return arr;
+}
+
+void MultiMeshBullets2D::all_bullets_set_directions_packed(const PackedVector2Array &new_directions, int bullet_index_start) {
+	if (!validate_packed_values_range(bullet_index_start, new_directions.size(), "all_bullets_set_directions_packed")) {
+		return;
+	}
+
+	const Vector2 *directions = new_directions.ptr();
+	const int amount_values = static_cast<int>(new_directions.size());
+
+	for (int i = 0; i < amount_values; ++i) {
+		set_bullet_direction(bullet_index_start + i, directions[i]);
+	}
+}
+
+PackedFloat32Array MultiMeshBullets2D::all_bullets_get_speeds_packed(int bullet_index_start, int bullet_index_end_inclusive) const {
+	ensure_indexes_match_amount_bullets_range(bullet_index_start, bullet_index_end_inclusive, "all_bullets_get_speeds_packed");
+
+	PackedFloat32Array arr;
+	arr.resize(bullet_index_end_inclusive - bullet_index_start + 1);
+	std::copy(all_cached_speed.begin() + bullet_index_start, all_cached_speed.begin() + bullet_index_end_inclusive + 1, arr.ptrw());
+
+	return arr;
+}
+
+void MultiMeshBullets2D::all_bullets_set_speeds_packed(const PackedFloat32Array &new_speeds, int bullet_index_start) {
+	if (!validate_packed_values_range(bullet_index_start, new_speeds.size(), "all_bullets_set_speeds_packed")) {
+		return;
+	}
+
+	if (shared_bullet_curves_data.is_valid() && shared_bullet_curves_data->movement_speed_curve.is_valid()) {
+		UtilityFunctions::push_warning("You are trying to set bullet speed data directly while having a movement speed curve assigned. The curve will override any direct speed data changes. Set the curve to null first if you want to set speed data directly.");
+		return;
+	}
+
+	const float *speeds = new_speeds.ptr();
+	const int amount_values = static_cast<int>(new_speeds.size());
+
+	// Bullets that have their own movement speed curve are skipped, since the curve would override the speed anyway
+	const bool has_individual_curves = !all_bullet_curves_data.empty();
+	int amount_skipped = 0;
+
+	for (int i = 0; i < amount_values; ++i) {
+		const int bullet_index = bullet_index_start + i;
+
+		if (has_individual_curves) {
+			const BulletCurvesData2D *curves_data = find_bullet_curves_data(bullet_index);
+			if (curves_data != nullptr && curves_data->movement_speed_curve.is_valid()) {
+				++amount_skipped;
+				continue;
+			}
+		}
+
+		const real_t new_speed = speeds[i];
+		all_cached_speed[bullet_index] = new_speed;
+
+		// Acceleration clamps the speed to the max speed, so the max speed has to at least allow the new speed
+		real_t &max_speed = all_cached_max_speed[bullet_index];
+		max_speed = Math::max(max_speed, new_speed);
+
+		all_cached_velocity[bullet_index] = all_cached_direction[bullet_index] * new_speed + inherited_velocity_offset;
+	}
+
+	if (amount_skipped > 0) {
+		UtilityFunctions::push_warning("You are trying to set bullet speed data directly while having a movement speed curve assigned as an individual bullet curves data. The curve will override any direct speed data changes, so " + String::num_int64(amount_skipped) + " bullets were skipped. Set the curve to null first if you want to set speed data directly.");
+	}
+}
+
+PackedFloat32Array MultiMeshBullets2D::all_bullets_get_texture_rotations_packed(int bullet_index_start, int bullet_index_end_inclusive) const {
+	ensure_indexes_match_amount_bullets_range(bullet_index_start, bullet_index_end_inclusive, "all_bullets_get_texture_rotations_packed");
+
+	PackedFloat32Array arr;
+	arr.resize(bullet_index_end_inclusive - bullet_index_start + 1);
+	float *rotations = arr.ptrw();
+
+	for (int i = bullet_index_start; i <= bullet_index_end_inclusive; ++i) {
+		rotations[i - bullet_index_start] = all_cached_instance_transforms[i].get_rotation();
+	}
+
+	return arr;
+}
+
+void MultiMeshBullets2D::all_bullets_set_texture_rotations_packed(const PackedFloat32Array &new_rotations_radians, int bullet_index_start) {
+	if (!validate_packed_values_range(bullet_index_start, new_rotations_radians.size(), "all_bullets_set_texture_rotations_packed")) {
+		return;
+	}
+
+	const float *rotations = new_rotations_radians.ptr();
+	const int amount_values = static_cast<int>(new_rotations_radians.size());
+
+	for (int i = 0; i < amount_values; ++i) {
+		set_bullet_texture_rotation_radians(bullet_index_start + i, rotations[i]);
+	}
+}
+
 void MultiMeshBullets2D::set_bullet_direction_towards_position(int bullet_index, const Vector2 &target_position) {
 	if (!validate_bullet_index(bullet_index, "set_bullet_direction_towards_position")) {
 		return;
@@ -787,7 +1201,9 @@ void MultiMeshBullets2D::set_bullet_texture_rotation_towards_position(int bullet
 	transf.set_rotation_and_scale(angle, scale);
 	transf.set_origin(pos);
 
-	multi->set_instance_transform_2d(bullet_index, transf);
+	if (all_bullets_enabled_set.contains(bullet_index)) { // Apply to multi only if the bullet is enabled (if disabled the transform is zero which prevents the multimesh from rendering it)
+		set_instance_buffer_transform(bullet_index, transf);
+	}
 
 	update_bullet_previous_transform_for_interpolation(bullet_index);
 }
@@ -836,8 +1252,13 @@ void MultiMeshBullets2D::set_curves_elapsed_time(real_t new_time) {
 }
 
 Ref<Curve2D> MultiMeshBullets2D::get_bullet_movement_pattern_curve(int bullet_index) const {
-	if (check_exists_bullet_movement_pattern_data(bullet_index)) {
-		return find_bullet_movement_pattern_data(bullet_index).path_curve;
+	if (!validate_bullet_index(bullet_index, "get_bullet_movement_pattern_curve")) {
+		return nullptr;
+	}
+
+	const BulletMovementPatternData2D *pattern = find_bullet_movement_pattern_data(bullet_index);
+	if (pattern != nullptr) {
+		return pattern->path_curve;
 	}
 
 	return nullptr;
@@ -875,12 +1296,16 @@ void MultiMeshBullets2D::all_bullets_set_movement_pattern_from_path(Path2D *path
 }
 
 void MultiMeshBullets2D::set_bullet_movement_pattern_from_curve(int bullet_index, const Ref<Curve2D> &curve_pattern, bool face_movement_direction, bool repeat_pattern) {
+	if (!validate_bullet_index(bullet_index, "set_bullet_movement_pattern_from_curve")) {
+		return;
+	}
+
 	if (curve_pattern.is_null()) {
 		remove_bullet_movement_pattern(bullet_index);
 		return;
 	}
 
-	all_movement_pattern_data[bullet_index] = BulletMovementPatternData2D{ curve_pattern, face_movement_direction, repeat_pattern };
+	all_movement_pattern_data.set(bullet_index, BulletMovementPatternData2D{ curve_pattern, face_movement_direction, repeat_pattern });
 }
 
 void MultiMeshBullets2D::all_bullets_set_movement_pattern_from_curve(const Ref<Curve2D> &curve_pattern, bool face_movement_direction, bool repeat_pattern, int start_index, int end_index_inclusive) {
@@ -897,9 +1322,7 @@ void MultiMeshBullets2D::all_bullets_set_movement_pattern_from_curve(const Ref<C
 }
 
 void MultiMeshBullets2D::remove_bullet_movement_pattern(int bullet_index) {
-	if (check_exists_bullet_movement_pattern_data(bullet_index)) {
-		all_movement_pattern_data.erase(bullet_index);
-	}
+	all_movement_pattern_data.erase(bullet_index);
 }
 
 void MultiMeshBullets2D::all_bullets_remove_movement_pattern(int start_index, int end_index_inclusive) {
@@ -916,11 +1339,13 @@ int MultiMeshBullets2D::get_collision_layer() const {
 
 void MultiMeshBullets2D::set_collision_layer(int new_collision_layer) {
 	physics_server->area_set_collision_layer(area, new_collision_layer);
+	applied_collision_layer = new_collision_layer;
 }
 
 void MultiMeshBullets2D::set_collision_layer_from_array(const TypedArray<int> &numbers) {
 	int bitmask = MultiMeshBulletsData2D::calculate_bitmask(numbers);
 	physics_server->area_set_collision_layer(area, bitmask);
+	applied_collision_layer = bitmask;
 }
 
 int MultiMeshBullets2D::get_collision_mask() const {
@@ -929,11 +1354,13 @@ int MultiMeshBullets2D::get_collision_mask() const {
 
 void MultiMeshBullets2D::set_collision_mask(int new_collision_mask) {
 	physics_server->area_set_collision_mask(area, new_collision_mask);
+	applied_collision_mask = new_collision_mask;
 }
 
 void MultiMeshBullets2D::set_collision_mask_from_array(const TypedArray<int> &numbers) {
 	int bitmask = MultiMeshBulletsData2D::calculate_bitmask(numbers);
 	physics_server->area_set_collision_mask(area, bitmask);
+	applied_collision_mask = bitmask;
 }
 
 bool MultiMeshBullets2D::get_monitorable() const {
@@ -982,6 +1409,15 @@ void MultiMeshBullets2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("all_bullets_get_transforms", "bullet_index_start", "bullet_index_end_inclusive"), &MultiMeshBullets2D::all_bullets_get_transforms, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("all_bullets_set_transforms", "new_transform", "set_direction_based_on_transform", "bullet_index_start", "bullet_index_end_inclusive"), &MultiMeshBullets2D::all_bullets_set_transforms, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 
+	ClassDB::bind_method(D_METHOD("all_bullets_get_positions_packed", "bullet_index_start", "bullet_index_end_inclusive"), &MultiMeshBullets2D::all_bullets_get_positions_packed, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("all_bullets_set_positions_packed", "new_positions", "bullet_index_start"), &MultiMeshBullets2D::all_bullets_set_positions_packed, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("all_bullets_get_directions_packed", "bullet_index_start", "bullet_index_end_inclusive"), &MultiMeshBullets2D::all_bullets_get_directions_packed, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("all_bullets_set_directions_packed", "new_directions", "bullet_index_start"), &MultiMeshBullets2D::all_bullets_set_directions_packed, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("all_bullets_get_speeds_packed", "bullet_index_start", "bullet_index_end_inclusive"), &MultiMeshBullets2D::all_bullets_get_speeds_packed, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("all_bullets_set_speeds_packed", "new_speeds", "bullet_index_start"), &MultiMeshBullets2D::all_bullets_set_speeds_packed, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("all_bullets_get_texture_rotations_packed", "bullet_index_start", "bullet_index_end_inclusive"), &MultiMeshBullets2D::all_bullets_get_texture_rotations_packed, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("all_bullets_set_texture_rotations_packed", "new_rotations_radians", "bullet_index_start"), &MultiMeshBullets2D::all_bullets_set_texture_rotations_packed, DEFVAL(0));
+
 	ClassDB::bind_method(D_METHOD("get_textures"), &MultiMeshBullets2D::get_textures);
 	ClassDB::bind_method(D_METHOD("set_textures", "new_textures", "new_change_texture_times", "selected_texture_index"), &MultiMeshBullets2D::set_textures, DEFVAL(0));
 
@@ -993,6 +1429,7 @@ void MultiMeshBullets2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("bullet_enable_attachment", "bullet_index"), &MultiMeshBullets2D::bullet_enable_attachment);
 
 	ClassDB::bind_method(D_METHOD("get_amount_bullets"), &MultiMeshBullets2D::get_amount_bullets);
+	ClassDB::bind_method(D_METHOD("get_amount_bullets_capacity"), &MultiMeshBullets2D::get_amount_bullets_capacity);
 
 	ClassDB::bind_method(D_METHOD("get_all_bullets_status"), &MultiMeshBullets2D::get_all_bullets_status);
 	ClassDB::bind_method(D_METHOD("is_bullet_status_enabled", "bullet_index"), &MultiMeshBullets2D::is_bullet_status_enabled);
@@ -1017,6 +1454,15 @@ void MultiMeshBullets2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("_do_execute_stored_callable_safely", "_callback", "_execute_only_if_multimesh_is_active"), &MultiMeshBullets2D::_do_execute_stored_callable_safely);
 
+	ClassDB::bind_method(D_METHOD("bullet_set_life_time", "bullet_index", "life_time"), &MultiMeshBullets2D::bullet_set_life_time);
+	ClassDB::bind_method(D_METHOD("bullet_clear_life_time", "bullet_index"), &MultiMeshBullets2D::bullet_clear_life_time);
+	ClassDB::bind_method(D_METHOD("bullet_get_life_time_left", "bullet_index"), &MultiMeshBullets2D::bullet_get_life_time_left);
+
+	ClassDB::bind_method(D_METHOD("get_amount_dropped_collisions"), &MultiMeshBullets2D::get_amount_dropped_collisions);
+
+	ClassDB::bind_method(D_METHOD("get_is_emitter"), &MultiMeshBullets2D::get_is_emitter);
+	ClassDB::bind_method(D_METHOD("get_amount_free_emitter_slots"), &MultiMeshBullets2D::get_amount_free_emitter_slots);
+
 	ClassDB::bind_method(D_METHOD("get_is_multimesh_auto_pooling_enabled"), &MultiMeshBullets2D::get_is_multimesh_auto_pooling_enabled);
 	ClassDB::bind_method(D_METHOD("set_is_multimesh_auto_pooling_enabled", "value"), &MultiMeshBullets2D::set_is_multimesh_auto_pooling_enabled);
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "is_multimesh_auto_pooling_enabled"), "set_is_multimesh_auto_pooling_enabled", "get_is_multimesh_auto_pooling_enabled");
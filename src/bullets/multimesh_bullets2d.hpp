@@ -4,7 +4,12 @@
 #include "../factory/bullet_factory2d.hpp"
 #include "../shared/bullet_attachment2d.hpp"
 #include "../shared/bullet_attachment_object_pool2d.hpp"
+#include "../shared/bullet_collision_grid2d.hpp"
+#include "../shared/bullet_expiry_wheel.hpp"
+#include "../shared/bounded_mpsc_queue.hpp"
 #include "../shared/bullet_rotation_data2d.hpp"
+#include "../shared/bullet_simd_kernels.hpp"
+#include "../shared/bullets_container2d.hpp"
 #include "../spawn-data/multimesh_bullets_data2d.hpp"
 #include "godot_cpp/classes/curve.hpp"
 #include "godot_cpp/classes/curve2d.hpp"
@@ -27,17 +32,20 @@
 #include "shared/bullet_curves_data2d.hpp"
 #include "shared/bullet_movement_pattern_data2d.hpp"
 #include "shared/bullet_speed_data2d.hpp"
+#include "shared/dense_feature_store.hpp"
 #include "shared/dynamic_sparse_set.hpp"
 
 #include <cstddef>
 #include <cstdint>
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/material.hpp>
 #include <godot_cpp/classes/mesh.hpp>
 #include <godot_cpp/classes/multi_mesh.hpp>
-#include <godot_cpp/classes/multi_mesh_instance2d.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
 #include <godot_cpp/classes/physics_server2d.hpp>
 #include <godot_cpp/classes/quad_mesh.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <iterator>
 #include <unordered_map>
@@ -48,8 +56,9 @@ using namespace godot;
 
 class MultiMeshObjectPool;
 
-class MultiMeshBullets2D : public MultiMeshInstance2D, public IDebuggerDataProvider2D {
-	GDCLASS(MultiMeshBullets2D, MultiMeshInstance2D)
+// A group of bullets that share a single multimesh and a single physics area. It's not a node - it draws through its own canvas item on the RenderingServer and collides through its own area on the PhysicsServer2D, while its lifetime is owned by the BulletFactory2D. The object itself is only a handle that exposes the bullets API to GDScript
+class MultiMeshBullets2D : public Object, public IDebuggerDataProvider2D {
+	GDCLASS(MultiMeshBullets2D, Object)
 public:
 	// Having constructors with initializer lists would be very cool, but Godot's memnew keyword sadly does not support that, so I'm left with using custom spawn() methods - Remeber when you create a new instance of this class with memnew you have to call a spawn method in order for everything to work
 
@@ -63,17 +72,32 @@ public:
 
 	bool marked_for_internal_deletion = false;
 
-	// Gets the total amount of bullets that the multimesh always holds
+	// When the multimesh was last pushed inside the object pool (Time::get_ticks_msec). Used to find multimeshes that have been idle for a long time
+	uint64_t pooled_since_msec = 0;
+
+	// The canvas item that draws the multimesh, a child of the canvas item of the bullets container
+	RID canvas_item;
+
+	// The index of the multimesh inside the bullets container
+	int bullets_container_index = -1;
+
+	// Handed out by the bullets container. Canvas items with a bigger draw index are drawn on top
+	int draw_index = -1;
+
+	// Gets the total amount of bullets that the multimesh holds since it was last spawned/enabled
 	_ALWAYS_INLINE_ int get_amount_bullets() const { return amount_bullets; };
 
+	// Gets the amount of bullet instances and collision shapes that the multimesh has allocated. Bigger than amount_bullets only when a pooled multimesh from a bigger size class got re-used
+	_ALWAYS_INLINE_ int get_amount_bullets_capacity() const { return amount_bullets_capacity; };
+
 	// Gets the total amount of attachments that are active
 	int get_amount_active_attachments() const;
 
-	// Used to spawn brand new bullets that are active in the scene tree
-	void spawn(const MultiMeshBulletsData2D &spawn_data, MultiMeshObjectPool *pool, BulletFactory2D *factory, Node *bullets_container, const Vector2 &new_inherited_velocity_offset, int new_sparse_set_id, bool spawn_in_pool);
+	// Used to spawn brand new bullets that are active in the world. The compiled arrays of the spawn data are used only if use_compiled_data is true (spawning from a template or an emitter)
+	void spawn(const MultiMeshBulletsData2D &spawn_data, MultiMeshObjectPool *pool, BulletFactory2D *factory, BulletsContainer2D &new_bullets_container, const Vector2 &new_inherited_velocity_offset, int new_sparse_set_id, bool spawn_in_pool, int new_amount_bullets_capacity, const Transform2D &new_spawn_origin = Transform2D(), bool use_compiled_data = false);
 
 	// Activates the multimesh
-	void enable_multimesh(const MultiMeshBulletsData2D &data, const Vector2 &new_inherited_velocity_offset);
+	void enable_multimesh(const MultiMeshBulletsData2D &data, const Vector2 &new_inherited_velocity_offset, const Transform2D &new_spawn_origin = Transform2D(), bool use_compiled_data = false);
 
 	// Internal delete - used on the C++ side only
 	void force_delete() {
@@ -85,14 +109,21 @@ public:
 
 	// Use this method when you want to use physics interpolation - smooth rendering of textures despite physics ticks per second
 	_ALWAYS_INLINE_ void interpolate_bullet_visuals() {
+		// Nothing moved during the last physics frame and the final transforms were already written
+		if (!have_bullets_moved && are_interpolated_transforms_settled) {
+			return;
+		}
+
 		double fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
 
 		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
 
+		float *instance_buffer_ptr = instance_buffer.ptrw();
+
 		for (int i : active_bullet_indexes) {
 			// Apply interpolated transform for the bullet
 			const Transform2D &interpolated_bullet_texture_transf = get_interpolated_transform(all_cached_instance_transforms[i], all_previous_instance_transf[i], fraction);
-			multi->set_instance_transform_2d(i, interpolated_bullet_texture_transf);
+			write_instance_buffer_transform(instance_buffer_ptr, i, interpolated_bullet_texture_transf);
 
 			if (!attachments[i]) {
 				continue;
@@ -102,6 +133,94 @@ public:
 			const Transform2D &interpolated_attachment_transf = get_interpolated_transform(attachment_transforms[i], all_previous_attachment_transf[i], fraction);
 			attachments[i]->set_global_transform(interpolated_attachment_transf);
 		}
+
+		is_instance_buffer_dirty = true;
+
+		// When nothing moved, the previous and the current transforms are the same, so this was the last write needed
+		are_interpolated_transforms_settled = !have_bullets_moved;
+	}
+
+	// Uploads all instance transforms to the rendering server with a single call. Does nothing if no instance was changed since the last upload
+	_ALWAYS_INLINE_ void sync_instance_buffer() {
+		if (!is_instance_buffer_dirty) {
+			return;
+		}
+
+		rendering_server->multimesh_set_buffer(multi->get_rid(), instance_buffer);
+		is_instance_buffer_dirty = false;
+	}
+
+	// Handles all collisions that were queued by the physics server. Always runs on the main thread, since it emits signals
+	_ALWAYS_INLINE_ void handle_all_collided_bullets() {
+		BulletCollisionData2D data;
+
+		while (collision_inbox.pop(data)) {
+			handle_bullet_collision(data.collision_type, data.bullet_index, data.collided_instance_id);
+		}
+	}
+
+	// Whether the collisions of these bullets are detected by the factory's collision grid instead of the physics server. Decided when the multimesh gets spawned/enabled
+	bool is_using_collision_grid = false;
+
+	// Moves the area back into the physics space, so the physics server detects the collisions of these bullets again. Used when the factory stops using the collision grid while these bullets are still around
+	void stop_using_collision_grid(const RID &physics_space);
+
+	// Inserts the collision shapes of all active bullets into the collision grid of the factory
+	_ALWAYS_INLINE_ void insert_bullets_into_collision_grid(BulletCollisionGrid2D &grid) {
+		if (!is_using_collision_grid) {
+			return;
+		}
+
+		const int multimesh_slot = grid.register_multimesh(this, cache_collision_shape_size / 2, static_cast<uint32_t>(physics_server->area_get_collision_mask(area)));
+
+		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
+
+		for (int i : active_bullet_indexes) {
+			grid.insert_bullet(multimesh_slot, i, all_cached_shape_origin[i]);
+		}
+	}
+
+	// Queues a collision detected by the collision grid. It gets handled exactly like the collisions reported by the physics server
+	_ALWAYS_INLINE_ void queue_collision_grid_collision(int bullet_index, int64_t entered_instance_id, bool is_body) {
+		collision_inbox.push(BulletCollisionData2D(bullet_index, entered_instance_id, is_body ? CollisionType::BODY : CollisionType::AREA));
+	}
+
+	// Applies everything that was skipped while the bullets were moved on worker threads - the collision shape transforms, the attachment transforms and the collisions. Always runs on the main thread
+	_ALWAYS_INLINE_ void apply_worker_thread_simulation_results() {
+		const bool is_using_physics_interpolation = bullet_factory->use_physics_interpolation;
+
+		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
+
+		bool have_any_bullets_moved = false;
+
+		for (int r = 0; r < amount_worker_thread_ranges; ++r) {
+			WorkerThreadRange &range = worker_thread_ranges[r];
+
+			for (int i : range.bullets_with_unsynced_shape_transforms) {
+				physics_server->area_set_shape_transform(area, i, all_cached_shape_transforms[i]);
+			}
+			range.bullets_with_unsynced_shape_transforms.clear();
+
+			have_any_bullets_moved |= range.have_any_bullets_moved;
+		}
+
+		amount_worker_thread_ranges = 0;
+		have_bullets_moved = have_any_bullets_moved;
+
+		// Bullets that stand still were not written to the instance buffer, so if none of them moved there is nothing to upload
+		if (!is_using_physics_interpolation && have_bullets_moved) {
+			is_instance_buffer_dirty = true;
+		}
+
+		if (!is_using_physics_interpolation) {
+			for (int i : active_bullet_indexes) {
+				if (attachments[i]) {
+					attachments[i]->set_global_transform(attachment_transforms[i]);
+				}
+			}
+		}
+
+		handle_all_collided_bullets();
 	}
 
 	_ALWAYS_INLINE_ void update_specific_previous_transforms_for_interpolation(int begin_bullet_index, int end_bullet_index_inclusive) {
@@ -155,6 +274,17 @@ public:
 	_ALWAYS_INLINE_ void reduce_lifetime(double delta) {
 		curves_elapsed_time += delta;
 
+		// Per-bullet lifetimes only touch the bullets that expire in the ticks that passed. All expired bullets get disabled at the end of the frame using a single deferred call
+		if (!bullet_expiry_wheel.empty()) {
+			const bool is_disable_queued = !bullets_with_expired_life_time.empty();
+
+			bullet_expiry_wheel.advance(delta, bullets_with_expired_life_time);
+
+			if (!is_disable_queued && !bullets_with_expired_life_time.empty()) {
+				callable_mp(this, &MultiMeshBullets2D::disable_bullets_with_expired_life_time).call_deferred();
+			}
+		}
+
 		// If the lifetime is infinite there is no lifetime timer
 		if (is_life_time_infinite) {
 			return;
@@ -163,43 +293,104 @@ public:
 		// Life time timer logic
 		current_life_time -= delta;
 
-		// The bullets still have life time left, so don't do anything yet
-		if (current_life_time > 0) {
+		// The bullets still have life time left (or they are already waiting to get disabled), so don't do anything yet
+		if (current_life_time > 0 || is_life_time_expiry_queued) {
 			return;
 		}
 
-		// Get ALL STILL ACTIVE bullets that we need to disable.. (bullets that haven't hit anything but the lifetime is over..)
-		const auto &active_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
+		// Disable ALL STILL ACTIVE bullets at the end of the frame using a single deferred call, no matter how many bullets there are
+		is_life_time_expiry_queued = true;
+		callable_mp(this, &MultiMeshBullets2D::disable_expired_bullets).call_deferred();
+	}
 
-		// If the life_time_over signal is not enabled, we can just disable all bullets right away and skip the additional logic
-		if (!is_life_time_over_signal_enabled) {
-			for (int i : active_bullet_indexes) {
-				call_deferred("disable_bullet", i, true); // Disable the attachments as well since we aren't really emitting signals that need to work with attachments..
-			}
+	// Disables all bullets that are still active once the life time is over. Always call this method deferred, same as disable_bullet
+	void disable_expired_bullets() {
+		// The multimesh might have been re-used before the deferred call happened
+		if (!is_life_time_expiry_queued) {
+			return;
+		}
+
+		is_life_time_expiry_queued = false;
+
+		// Copy the indexes, since the enabled set gets cleared before the attachments are disabled
+		expired_bullet_indexes = all_bullets_enabled_set.get_active_indexes();
 
+		if (expired_bullet_indexes.empty()) {
 			return;
 		}
 
-		// If the life_time_over signal is enabled
+		// Stop rendering all instances and disable all collision shapes in a single pass
+		float *buffer = instance_buffer.ptrw();
 
-		// If the user wants to track when the life time is over we need to collect some additional info about the multimesh
-		// Will hold all transforms of bullets that have not yet hit anything / the ones we are forced to disable due to life time being over
-		TypedArray<Transform2D> transfs;
-		TypedArray<int> bullet_indexes;
+		for (int i : expired_bullet_indexes) {
+			write_instance_buffer_transform(buffer, i, zero_transform);
+			physics_server->area_set_shape_disabled(area, i, true);
+		}
 
-		for (int i : active_bullet_indexes) {
-			call_deferred("disable_bullet", i, false); // Don't disable attachments yet, first emit the signal for lifetime over and only after that
+		is_instance_buffer_dirty = true;
+		all_bullets_enabled_set.clear();
+
+		emit_life_time_over_and_disable_attachments();
 
-			transfs.push_back(all_cached_instance_transforms[i]); // Store the transform of the disabled bullet
-			bullet_indexes.push_back(i);
+		disable_multimesh();
+	}
+
+	// Disables the bullets whose own lifetime is over (see bullet_set_life_time). Always call this method deferred, same as disable_bullet
+	void disable_bullets_with_expired_life_time() {
+		expired_bullet_indexes.clear();
+
+		float *buffer = instance_buffer.ptrw();
+
+		for (const BulletExpiryWheel::ExpiredBullet &expired_bullet : bullets_with_expired_life_time) {
+			const int bullet_index = expired_bullet.first;
+
+			// The lifetime might have been replaced or the bullet might have been disabled since it expired
+			if (!bullet_expiry_wheel.is_still_expired(expired_bullet) || !all_bullets_enabled_set.contains(bullet_index)) {
+				continue;
+			}
+
+			bullet_expiry_wheel.cancel(bullet_index);
+
+			write_instance_buffer_transform(buffer, bullet_index, zero_transform);
+			physics_server->area_set_shape_disabled(area, bullet_index, true);
+			all_bullets_enabled_set.disable_data(bullet_index);
+
+			expired_bullet_indexes.emplace_back(bullet_index);
 		}
 
-		// Emit a signal and pass all the transforms of bullets that were forcefully disabled / the ones that were disabled due to life time being over (NOT because they hit a collision shape/body)
-		bullet_factory->call_deferred("emit_signal", "life_time_over", this, bullet_indexes, bullets_custom_data, transfs);
+		bullets_with_expired_life_time.clear();
 
-		// Now we can finally disable all attachments after the signal was emitted
-		for (int i : active_bullet_indexes) {
-			call_deferred("bullet_disable_attachment", i);
+		if (expired_bullet_indexes.empty()) {
+			return;
+		}
+
+		is_instance_buffer_dirty = true;
+		active_bullets_counter -= static_cast<int>(expired_bullet_indexes.size());
+
+		emit_life_time_over_and_disable_attachments();
+
+		if (active_bullets_counter <= 0 && !is_emitter) {
+			disable_multimesh();
+		}
+	}
+
+	// If the user wants to track when the life time is over, emits a signal with all bullets inside expired_bullet_indexes (they were forcefully disabled, NOT because they hit a collision shape/body)
+	// The attachments are disabled only after that, so the user still has access to them inside the signal callback
+	void emit_life_time_over_and_disable_attachments() {
+		if (is_life_time_over_signal_enabled) {
+			TypedArray<Transform2D> transfs;
+			TypedArray<int> bullet_indexes;
+
+			for (int i : expired_bullet_indexes) {
+				transfs.push_back(all_cached_instance_transforms[i]);
+				bullet_indexes.push_back(i);
+			}
+
+			bullet_factory->emit_signal("life_time_over", this, bullet_indexes, bullets_custom_data, transfs);
+		}
+
+		for (int i : expired_bullet_indexes) {
+			bullet_disable_attachment(i);
 		}
 	}
 
@@ -276,6 +467,23 @@ public:
 	bool get_is_attachments_auto_pooling_enabled() const { return is_attachments_auto_pooling_enabled; }
 	void set_is_attachments_auto_pooling_enabled(bool value) { is_attachments_auto_pooling_enabled = value; }
 
+	bool get_is_emitter() const { return is_emitter; }
+
+	// How many collisions were dropped because the collision inbox was full. Should always be 0, otherwise some collisions were never reported
+	int64_t get_amount_dropped_collisions() const { return static_cast<int64_t>(collision_inbox.get_amount_overflowed()); }
+
+	// PER BULLET LIFE TIME
+
+	// Gives a single bullet its own lifetime - it gets disabled (and the life_time_over signal gets emitted for it) once the lifetime is over, no matter the lifetime of the multimesh. Replaces the old lifetime of the bullet
+	void bullet_set_life_time(int bullet_index, double life_time);
+	void bullet_clear_life_time(int bullet_index);
+
+	// Returns -1 if the bullet doesn't have its own lifetime
+	double bullet_get_life_time_left(int bullet_index) const;
+
+	// The amount of bullets that can still be emitted before the emitter is full
+	int get_amount_free_emitter_slots() const { return is_emitter ? amount_bullets - active_bullets_counter : 0; }
+
 	Ref<BulletCurvesData2D> get_shared_bullet_curves_data() const { return shared_bullet_curves_data; }
 	void set_shared_bullet_curves_data(const Ref<BulletCurvesData2D> &new_curves_data) { populate_shared_curves_related_data(new_curves_data); }
 
@@ -379,20 +587,32 @@ public:
 	TypedArray<Transform2D> all_bullets_get_transforms(int bullet_index_start = 0, int bullet_index_end_inclusive = -1) const;
 	void all_bullets_set_transforms(const Transform2D &new_transform, bool set_direction_based_on_transform = false, int bullet_index_start = 0, int bullet_index_end_inclusive = -1);
 
+	// Packed Bullet State (copied straight from/into the internal storage, no Variant per bullet)
+
+	PackedVector2Array all_bullets_get_positions_packed(int bullet_index_start = 0, int bullet_index_end_inclusive = -1) const;
+	void all_bullets_set_positions_packed(const PackedVector2Array &new_positions, int bullet_index_start = 0);
+
+	PackedVector2Array all_bullets_get_directions_packed(int bullet_index_start = 0, int bullet_index_end_inclusive = -1) const;
+	void all_bullets_set_directions_packed(const PackedVector2Array &new_directions, int bullet_index_start = 0);
+
+	PackedFloat32Array all_bullets_get_speeds_packed(int bullet_index_start = 0, int bullet_index_end_inclusive = -1) const;
+	void all_bullets_set_speeds_packed(const PackedFloat32Array &new_speeds, int bullet_index_start = 0);
+
+	PackedFloat32Array all_bullets_get_texture_rotations_packed(int bullet_index_start = 0, int bullet_index_end_inclusive = -1) const;
+	void all_bullets_set_texture_rotations_packed(const PackedFloat32Array &new_rotations_radians, int bullet_index_start = 0);
+
 	real_t get_curves_elapsed_time() const;
 	void set_curves_elapsed_time(real_t new_time);
 
 	// Bullet movement pattern
 
 	_ALWAYS_INLINE_ bool check_exists_bullet_movement_pattern_data(int bullet_index) const {
-		const auto it = all_movement_pattern_data.find(bullet_index);
-		const auto end = all_movement_pattern_data.end();
-
-		return it != end;
+		return all_movement_pattern_data.contains(bullet_index);
 	}
 
-	_ALWAYS_INLINE_ BulletMovementPatternData2D find_bullet_movement_pattern_data(int bullet_index) const {
-		return all_movement_pattern_data.at(bullet_index);
+	// Returns nullptr if the bullet has no movement pattern. The bullet index must be valid
+	_ALWAYS_INLINE_ const BulletMovementPatternData2D *find_bullet_movement_pattern_data(int bullet_index) const {
+		return all_movement_pattern_data.find(bullet_index);
 	}
 
 	Ref<Curve2D> get_bullet_movement_pattern_curve(int bullet_index) const;
@@ -429,18 +649,138 @@ protected:
 	// Counts all active bullets
 	int active_bullets_counter = 0;
 
+	// An emitter is a long-lived multimesh with a fixed capacity - bullets get emitted into free slots one by one and retire one by one, while the multimesh itself never goes back to the object pool
+	bool is_emitter = false;
+
+	// Where the search for a free slot starts. Advances like a ring buffer, so when bullets retire roughly in the order they were emitted the next free slot is found right away
+	int emitter_next_slot = 0;
+
 	// Used to store all bullets active state and enable fast lookups and removals
 	DynamicSparseSet all_bullets_enabled_set;
 
 	BulletFactory2D *bullet_factory = nullptr;
 	MultiMeshObjectPool *bullets_pool = nullptr;
+	BulletsContainer2D *bullets_container = nullptr;
 	PhysicsServer2D *physics_server = nullptr;
+	RenderingServer *rendering_server = nullptr;
 
-	std::vector<RID> physics_shapes;
+	// The rectangle shape that every bullet of the area uses. Shared with all other multimeshes that have the same collision shape size
+	RID physics_shape;
+	Vector2 physics_shape_size = Vector2(0, 0);
 
 	// This is used to effectively hide a single bullet instance from being rendered by the multimesh
 	const Transform2D zero_transform = Transform2D().scaled(Vector2(0, 0));
 
+	// The amount of floats a single instance takes inside the multimesh buffer (the multimesh uses TRANSFORM_2D without colors and without custom data)
+	static constexpr int INSTANCE_BUFFER_STRIDE = 8;
+
+	// Holds the raw instance data of the multimesh. Every instance transform change is written here and the whole buffer is uploaded with a single multimesh_set_buffer call per frame, instead of calling set_instance_transform_2d for each bullet
+	PackedFloat32Array instance_buffer;
+
+	// Whether the instance_buffer was changed and needs to be uploaded again
+	bool is_instance_buffer_dirty = false;
+
+	// Writes a transform in the layout the rendering server expects for TRANSFORM_2D multimeshes. Get the buffer_ptr once with instance_buffer.ptrw() before looping through bullets
+	_ALWAYS_INLINE_ static void write_instance_buffer_transform(float *buffer_ptr, int bullet_index, const Transform2D &transf) {
+		float *data = buffer_ptr + bullet_index * INSTANCE_BUFFER_STRIDE;
+
+		data[0] = transf.columns[0].x;
+		data[1] = transf.columns[1].x;
+		data[2] = 0.0f;
+		data[3] = transf.columns[2].x;
+		data[4] = transf.columns[0].y;
+		data[5] = transf.columns[1].y;
+		data[6] = 0.0f;
+		data[7] = transf.columns[2].y;
+	}
+
+	// Offset by which the whole multimesh was moved through its canvas item and area transforms instead of moving each bullet individually. Always zero unless the bullet type moves all of its bullets as a single rigid unit (BlockBullets2D). The instance and shape transforms that the servers hold are relative to it, while all cached transforms stay global
+	Vector2 rigid_movement_offset = Vector2(0, 0);
+
+	// Sets the transform of a single instance. Use this outside of the hot loops
+	_ALWAYS_INLINE_ void set_instance_buffer_transform(int bullet_index, const Transform2D &transf) {
+		write_instance_buffer_transform(instance_buffer.ptrw(), bullet_index, transf.translated(-rigid_movement_offset));
+		is_instance_buffer_dirty = true;
+	}
+
+	// Stops rendering a single instance by giving it a zero transform
+	_ALWAYS_INLINE_ void hide_instance_buffer_transform(int bullet_index) {
+		write_instance_buffer_transform(instance_buffer.ptrw(), bullet_index, zero_transform);
+		is_instance_buffer_dirty = true;
+	}
+
+	// Sets the transform of a single collision shape. Use this outside of the hot loops
+	_ALWAYS_INLINE_ void set_shape_transform_for_area(int bullet_index, const Transform2D &transf) {
+		physics_server->area_set_shape_transform(area, bullet_index, transf.translated(-rigid_movement_offset));
+	}
+
+	// A part of the active bullets that gets moved by a single worker thread task. Each range has its own results, so the worker threads never write to the same containers
+	struct WorkerThreadRange {
+		int active_index_begin = 0;
+		int active_index_end = 0;
+
+		// The bullets whose collision shape transform changed while the range was moved. Only these get pushed to the physics server by apply_worker_thread_simulation_results
+		std::vector<int> bullets_with_unsynced_shape_transforms;
+
+		bool have_any_bullets_moved = false;
+	};
+
+	// Only the first amount_worker_thread_ranges are used during the current physics frame. The rest are kept, so that their vectors don't have to allocate again
+	std::vector<WorkerThreadRange> worker_thread_ranges;
+	int amount_worker_thread_ranges = 0;
+
+	// Splits the active bullets into evenly sized ranges of at most max_bullets_per_range bullets. Every range except the last one holds a multiple of BulletSimdKernels::LANE_PADDING bullets, so the SIMD kernels of different ranges never touch the same register worth of values. Returns the amount of ranges
+	_ALWAYS_INLINE_ int split_active_bullets_into_worker_thread_ranges(int max_bullets_per_range) {
+		const int64_t amount_active_bullets = static_cast<int64_t>(all_bullets_enabled_set.get_active_indexes().size());
+		amount_worker_thread_ranges = Math::max(static_cast<int>((amount_active_bullets + max_bullets_per_range - 1) / max_bullets_per_range), 1);
+
+		if (static_cast<int>(worker_thread_ranges.size()) < amount_worker_thread_ranges) {
+			worker_thread_ranges.resize(amount_worker_thread_ranges);
+		}
+
+		for (int r = 0; r < amount_worker_thread_ranges; ++r) {
+			WorkerThreadRange &range = worker_thread_ranges[r];
+			range.active_index_begin = static_cast<int>(amount_active_bullets * r / amount_worker_thread_ranges) & ~(BulletSimdKernels::LANE_PADDING - 1);
+			range.active_index_end = r == amount_worker_thread_ranges - 1 ? static_cast<int>(amount_active_bullets) : static_cast<int>(amount_active_bullets * (r + 1) / amount_worker_thread_ranges) & ~(BulletSimdKernels::LANE_PADDING - 1);
+			range.have_any_bullets_moved = false;
+
+			// Filled on a worker thread, so it should never have to allocate there
+			range.bullets_with_unsynced_shape_transforms.reserve(range.active_index_end - range.active_index_begin);
+		}
+
+		return amount_worker_thread_ranges;
+	}
+
+	// Whether any bullet changed its transform during the last physics frame
+	bool have_bullets_moved = true;
+
+	// Whether interpolate_bullet_visuals already wrote the final transforms of a physics frame in which nothing moved, so there is nothing left to interpolate until something moves again
+	bool are_interpolated_transforms_settled = false;
+
+	// Stores the new collision shape transform of a bullet that is being moved and pushes it to the physics server. Returns false without doing anything if the transform didn't change, so bullets that stand still cost no server calls.
+	// On a worker thread (worker_thread_range is not nullptr) the bullet is only remembered and gets pushed later by apply_worker_thread_simulation_results
+	_ALWAYS_INLINE_ bool sync_shape_transform_if_changed(int bullet_index, const Transform2D &new_shape_transf, WorkerThreadRange *worker_thread_range) {
+		Transform2D &curr_shape_transf = all_cached_shape_transforms[bullet_index];
+
+		if (curr_shape_transf == new_shape_transf) {
+			return false;
+		}
+
+		curr_shape_transf = new_shape_transf;
+
+		if (is_using_collision_grid) {
+			return true;
+		}
+
+		if (worker_thread_range != nullptr) {
+			worker_thread_range->bullets_with_unsynced_shape_transforms.emplace_back(bullet_index);
+		} else {
+			physics_server->area_set_shape_transform(area, bullet_index, new_shape_transf);
+		}
+
+		return true;
+	}
+
 	///
 
 	/// ROTATION RELATED
@@ -493,6 +833,9 @@ protected:
 	// The amount of bullets the multimesh has
 	int amount_bullets = 0;
 
+	// The amount of bullet instances and collision shapes that were allocated. The ones after amount_bullets are never rendered (visible_instance_count) and their collision shapes stay disabled
+	int amount_bullets_capacity = 0;
+
 	// Pointer to the multimesh instead of always calling the get method
 	Ref<MultiMesh> multi = nullptr;
 
@@ -508,6 +851,18 @@ protected:
 	// The current life time being processed
 	double current_life_time = 0.0;
 
+	// Whether the life time is over and disable_expired_bullets is waiting to be called
+	bool is_life_time_expiry_queued = false;
+
+	// Scratch memory for disable_expired_bullets and disable_bullets_with_expired_life_time
+	std::vector<int> expired_bullet_indexes;
+
+	// Optional per-bullet lifetimes, independent of the lifetime of the multimesh
+	BulletExpiryWheel bullet_expiry_wheel;
+
+	// Bullets whose own lifetime is over and that are waiting for disable_bullets_with_expired_life_time
+	std::vector<BulletExpiryWheel::ExpiredBullet> bullets_with_expired_life_time;
+
 	// Elapsed time from multimesh activation, used for curves
 	double curves_elapsed_time = 0.0;
 
@@ -517,6 +872,16 @@ protected:
 	// If a ShaderMaterial was provided and it has instance shader parameters, then they should get cached here
 	Dictionary instance_shader_parameters;
 
+	/// CANVAS ITEM RELATED
+
+	// What the canvas item currently uses, so that only the values that change get sent to the rendering server. The defaults are the ones of a new canvas item
+	Ref<Texture2D> texture;
+	Ref<Material> material;
+	int z_index = 0;
+	int light_mask = 1;
+	uint32_t visibility_layer = 1;
+	bool is_visible = true;
+
 	/// TEXTURE RELATED
 
 	// Holds all textures
@@ -531,13 +896,26 @@ protected:
 	// Holds the current texture index (the index inside the array textures)
 	int current_texture_index = 0;
 
+	// The transform that the bullets of compiled spawn data are placed relative to. Identity unless the bullets were spawned from a template
+	Transform2D spawn_origin;
+
+	// Whether the bullets are being set up from the compiled arrays of the spawn data instead of its per-bullet arrays
+	bool is_using_compiled_data = false;
+
 	// This is the texture size of the bullets
 	Vector2 texture_size = Vector2(0, 0);
 
+	// Whether the multimesh uses the shared QuadMesh of texture_size (false if a custom mesh was provided)
+	bool is_using_shared_quad_mesh = false;
+
 	real_t cache_texture_rotation_radians = 0.0;
 
+	bool cache_is_texture_rotation_permanent = false;
+
 	Vector2 cache_collision_shape_offset = Vector2(0, 0);
 
+	Vector2 cache_collision_shape_size = Vector2(0, 0);
+
 	TypedArray<Transform2D> cache_texture_transforms;
 
 	///
@@ -549,7 +927,8 @@ protected:
 	std::vector<real_t> all_cached_acceleration;
 
 	Ref<BulletCurvesData2D> shared_bullet_curves_data = nullptr;
-	std::unordered_map<int, Ref<BulletCurvesData2D>> all_bullet_curves_data;
+	// Individual curves data for the bullets that have it. Indexed by bullet index without any hashing
+	DenseFeatureStore<Ref<BulletCurvesData2D>> all_bullet_curves_data;
 
 	///
 
@@ -577,7 +956,8 @@ protected:
 
 	/// BULLET MOVEMENT PATTERN RELATED
 
-	std::unordered_map<int, BulletMovementPatternData2D> all_movement_pattern_data;
+	// Movement pattern data for the bullets that have it. Indexed by bullet index without any hashing
+	DenseFeatureStore<BulletMovementPatternData2D> all_movement_pattern_data;
 
 	///
 
@@ -611,8 +991,11 @@ protected:
 				collision_type(new_collision_type) {}
 	};
 
-	// All bullets that have collided this physics frame
-	std::vector<BulletCollisionData2D> all_collided_bullets;
+	// All bullets that have collided since the collisions were last handled. The physics server might report collisions from the physics thread (physics/2d/run_on_separate_thread) while the main thread handles them, so this is a lock-free queue instead of a vector
+	BoundedMPSCQueue<BulletCollisionData2D> collision_inbox;
+
+	// How many collisions the inbox can hold per bullet before collisions start getting dropped
+	static constexpr int COLLISION_INBOX_SLOTS_PER_BULLET = 4;
 
 	// How many times a single bullet can collide before being disabled. If you set to 0 the bullet will never be disabled due to collisions.
 	int bullet_max_collision_count = 1;
@@ -623,6 +1006,12 @@ protected:
 	// Saves whether the bullets can detect bodies or not
 	bool monitorable = false;
 
+	// The area state that was last applied to the physics server. A pooled multimesh that gets enabled again only applies what actually changed
+	bool is_area_state_applied = false;
+	RID applied_area_space;
+	int applied_collision_layer = 0;
+	int applied_collision_mask = 0;
+
 	// Holds current collision count for each bullet
 	std::vector<int> bullets_current_collision_count;
 
@@ -655,6 +1044,16 @@ protected:
 		}
 	}
 
+	// Validates that a packed array of per-bullet values starting at bullet_index_start fits inside the multimesh
+	_ALWAYS_INLINE_ bool validate_packed_values_range(int bullet_index_start, int64_t amount_values, const String &function_name) const {
+		if (bullet_index_start < 0 || bullet_index_start + amount_values > amount_bullets) {
+			UtilityFunctions::push_error("Invalid index range in " + function_name + ". The values don't fit inside the bullets of the multimesh. Ignoring the request");
+			return false;
+		}
+
+		return true;
+	}
+
 	//////////////////// CURVES RELATED
 	_ALWAYS_INLINE_ void populate_shared_curves_related_data(const Ref<BulletCurvesData2D> &new_curves_data) {
 		if (new_curves_data.is_null()) {
@@ -675,19 +1074,31 @@ protected:
 			}
 		}
 
+		// The curves are shared, so every bullet gets the same values
+		const BulletCurvesData2D *curves_data = shared_bullet_curves_data.ptr();
+		const real_t movement_speed = is_movement_curve_valid ? get_bullet_curves_movement_speed(curves_data) : 0.0;
+		const real_t rotation_speed = is_rotation_curve_valid ? get_bullet_curves_rotation_speed(curves_data) : 0.0;
+		const real_t x_direction_offset = is_x_direction_curve_valid ? get_bullet_curves_x_direction_offset(curves_data) : 0.0;
+		const real_t y_direction_offset = is_y_direction_curve_valid ? get_bullet_curves_y_direction_offset(curves_data) : 0.0;
+
 		for (int i = 0; i < amount_bullets; ++i) {
 			if (is_movement_curve_valid) {
-				all_cached_speed[i] = get_bullet_curves_movement_speed(shared_bullet_curves_data.ptr());
+				all_cached_speed[i] = movement_speed;
 			}
 
 			if (is_rotation_curve_valid) {
-				all_rotation_speed[i] = get_bullet_curves_rotation_speed(shared_bullet_curves_data.ptr());
+				all_rotation_speed[i] = rotation_speed;
 			}
 
 			auto &current_direction = all_cached_direction[i];
 
-			apply_x_direction_curve(current_direction, shared_bullet_curves_data.ptr());
-			apply_y_direction_curve(current_direction, shared_bullet_curves_data.ptr());
+			if (is_x_direction_curve_valid) {
+				apply_x_direction_curve_offset(current_direction, x_direction_offset, curves_data);
+			}
+
+			if (is_y_direction_curve_valid) {
+				apply_y_direction_curve_offset(current_direction, y_direction_offset, curves_data);
+			}
 
 			if (is_movement_curve_valid || is_x_direction_curve_valid || is_y_direction_curve_valid) {
 				all_cached_velocity[i] = all_cached_direction[i] * all_cached_speed[i] + inherited_velocity_offset;
@@ -697,15 +1108,11 @@ protected:
 
 	_ALWAYS_INLINE_ void populate_individual_bullet_curves_related_data(int bullet_index, const Ref<BulletCurvesData2D> &new_curves_data) {
 		if (new_curves_data.is_null()) {
-			bool previous_curve_exists = find_bullet_curves_data(bullet_index) != nullptr;
-			if (previous_curve_exists) {
-				all_bullet_curves_data.erase(bullet_index);
-			}
+			all_bullet_curves_data.erase(bullet_index);
 			return;
 		}
 
-		auto &curr_curves = all_bullet_curves_data[bullet_index]; // This will create a brand new KVP if it doesn't exist
-		curr_curves = new_curves_data;
+		const auto &curr_curves = all_bullet_curves_data.set(bullet_index, new_curves_data);
 
 		const bool is_movement_curve_valid = curr_curves->movement_speed_curve.is_valid();
 		const bool is_rotation_curve_valid = curr_curves->rotation_speed_curve.is_valid();
@@ -741,13 +1148,17 @@ protected:
 
 	// Applies the x direction curve offset to the provided direction vector and normalizes it
 	_ALWAYS_INLINE_ void apply_x_direction_curve(Vector2 &direction_vector, const BulletCurvesData2D *curves_data) const {
-		const bool is_x_direction_curve_valid = curves_data != nullptr && curves_data->get_x_direction_curve().is_valid();
+		const bool is_x_direction_curve_valid = curves_data != nullptr && curves_data->x_direction_curve.is_valid();
 
 		if (!is_x_direction_curve_valid) {
 			return;
 		}
 
-		const real_t x_dir_offset = get_bullet_curves_x_direction_offset(curves_data);
+		apply_x_direction_curve_offset(direction_vector, get_bullet_curves_x_direction_offset(curves_data), curves_data);
+	}
+
+	// Same as apply_x_direction_curve, but with an offset that was already sampled from the x direction curve
+	_ALWAYS_INLINE_ void apply_x_direction_curve_offset(Vector2 &direction_vector, real_t x_dir_offset, const BulletCurvesData2D *curves_data) const {
 		const real_t x_direction_curve_strength = curves_data->x_direction_curve_strength;
 		auto x_curve_mode = curves_data->x_direction_curve_mode;
 
@@ -762,13 +1173,17 @@ protected:
 
 	// Applies the y direction curve offset to the provided direction vector and normalizes it
 	_ALWAYS_INLINE_ void apply_y_direction_curve(Vector2 &direction_vector, const BulletCurvesData2D *curves_data) const {
-		const bool is_y_direction_curve_valid = curves_data != nullptr && curves_data->get_y_direction_curve().is_valid();
+		const bool is_y_direction_curve_valid = curves_data != nullptr && curves_data->y_direction_curve.is_valid();
 
 		if (!is_y_direction_curve_valid) {
 			return;
 		}
 
-		const real_t y_dir_offset = get_bullet_curves_y_direction_offset(curves_data);
+		apply_y_direction_curve_offset(direction_vector, get_bullet_curves_y_direction_offset(curves_data), curves_data);
+	}
+
+	// Same as apply_y_direction_curve, but with an offset that was already sampled from the y direction curve
+	_ALWAYS_INLINE_ void apply_y_direction_curve_offset(Vector2 &direction_vector, real_t y_dir_offset, const BulletCurvesData2D *curves_data) const {
 		const real_t y_direction_curve_strength = curves_data->y_direction_curve_strength;
 		auto y_curve_mode = curves_data->y_direction_curve_mode;
 
@@ -781,12 +1196,13 @@ protected:
 		direction_vector = direction_vector.normalized();
 	}
 
+	// The curve getters below read from the baked lookup tables of the curves, so they never call into the engine
 	_ALWAYS_INLINE_ real_t get_bullet_curves_movement_speed(const BulletCurvesData2D *curves_data) const {
 		const bool use_unit_curve = curves_data->movement_use_unit_curve && !is_life_time_infinite;
 
 		real_t input_x = curve_get_input_value(use_unit_curve);
 
-		return curves_data->movement_speed_curve->sample_baked(input_x);
+		return curves_data->movement_speed_lut.sample(input_x);
 	}
 
 	_ALWAYS_INLINE_ real_t get_bullet_curves_rotation_speed(const BulletCurvesData2D *curves_data) const {
@@ -794,7 +1210,7 @@ protected:
 
 		real_t input_x = curve_get_input_value(use_unit_curve);
 
-		return curves_data->rotation_speed_curve->sample_baked(input_x);
+		return curves_data->rotation_speed_lut.sample(input_x);
 	}
 
 	_ALWAYS_INLINE_ real_t get_bullet_curves_x_direction_offset(const BulletCurvesData2D *curves_data) const {
@@ -802,7 +1218,7 @@ protected:
 
 		real_t input_x = curve_get_input_value(use_unit_curve);
 
-		return curves_data->x_direction_curve->sample_baked(input_x);
+		return curves_data->x_direction_lut.sample(input_x);
 	}
 
 	_ALWAYS_INLINE_ real_t get_bullet_curves_y_direction_offset(const BulletCurvesData2D *curves_data) const {
@@ -810,7 +1226,7 @@ protected:
 
 		real_t input_x = curve_get_input_value(use_unit_curve);
 
-		return curves_data->y_direction_curve->sample_baked(input_x);
+		return curves_data->y_direction_lut.sample(input_x);
 	}
 
 	_ALWAYS_INLINE_ void apply_direction_curve_texture_rotation_if_needed(Vector2 &curr_bullet_direction, Transform2D &curr_bullet_transf, double delta, const BulletCurvesData2D *curves_data) const {
@@ -843,15 +1259,15 @@ protected:
 		return input_x;
 	}
 
+	// Returns nullptr if the bullet has no individual curves data. The bullet index must be valid
 	_ALWAYS_INLINE_ BulletCurvesData2D *find_bullet_curves_data(int bullet_index) const {
-		const auto it = all_bullet_curves_data.find(bullet_index);
-		const auto end = all_bullet_curves_data.end();
+		const Ref<BulletCurvesData2D> *curves_data = all_bullet_curves_data.find(bullet_index);
 
-		if (it == end) {
+		if (curves_data == nullptr) {
 			return nullptr;
 		}
 
-		return it->second.ptr();
+		return curves_data->ptr();
 	}
 
 	Ref<BulletCurvesData2D> bullet_get_curves_data(int bullet_index) const {
@@ -859,15 +1275,15 @@ protected:
 			return Ref<BulletCurvesData2D>();
 		}
 
-		const int amount_curves_data = all_bullet_curves_data.size();
+		const Ref<BulletCurvesData2D> *curves_data = all_bullet_curves_data.find(bullet_index);
 
-		if (amount_curves_data < 1 || amount_curves_data - 1 < bullet_index) {
+		if (curves_data == nullptr) {
 			UtilityFunctions::push_error("Invalid bullet_index at bullet_get_curves_data(). This bullet has no individual curves data, did you mean to access shared_bullet_curves_data?");
 
 			return Ref<BulletCurvesData2D>();
 		}
 
-		return find_bullet_curves_data(bullet_index);
+		return *curves_data;
 	}
 
 	void bullet_set_curves_data(int bullet_index, const Ref<BulletCurvesData2D> &curves_data) {
@@ -918,10 +1334,14 @@ protected:
 
 	// Accelerates bullet speed using a curve
 	_ALWAYS_INLINE_ void bullet_accelerate_speed_using_curve(int bullet_index, double delta, const BulletCurvesData2D *curves_data) {
-		real_t &curr_bullet_speed = all_cached_speed[bullet_index];
-		curr_bullet_speed = get_bullet_curves_movement_speed(curves_data);
+		bullet_set_speed_from_curve(bullet_index, get_bullet_curves_movement_speed(curves_data));
+	}
 
-		all_cached_velocity[bullet_index] = all_cached_direction[bullet_index] * curr_bullet_speed + inherited_velocity_offset;
+	// Sets a speed value that was already sampled from a movement speed curve
+	_ALWAYS_INLINE_ void bullet_set_speed_from_curve(int bullet_index, real_t new_speed) {
+		all_cached_speed[bullet_index] = new_speed;
+
+		all_cached_velocity[bullet_index] = all_cached_direction[bullet_index] * new_speed + inherited_velocity_offset;
 	}
 
 	// Accelerates bullet rotation speed
@@ -1143,18 +1563,21 @@ protected:
 		shared_bullet_curves_data = Ref<BulletCurvesData2D>();
 		all_bullet_curves_data.clear();
 		all_movement_pattern_data.clear();
+		bullet_expiry_wheel.clear();
+		bullets_with_expired_life_time.clear();
 
-		set_visible(false); // Hide the multimesh node itself
+		set_visible(false); // Hide the multimesh itself
 
 		custom_additional_disable_logic();
 
-		if (!is_multimesh_auto_pooling_enabled) {
+		// Emitters stay alive until they get freed by the factory
+		if (!is_multimesh_auto_pooling_enabled || is_emitter) {
 			return;
 		}
 
 		// Remove all attached timers
 		_do_detach_all_time_based_functions(); // TODO maybe a separate property for this setting is more appropriate for consistent behavior?
-		bullets_pool->push(this, amount_bullets);
+		bullets_pool->push(this, amount_bullets_capacity);
 	}
 
 	_ALWAYS_INLINE_ void enable_bullet(int bullet_index, int collision_amount = 0, bool should_enable_attachment = true) {
@@ -1171,8 +1594,9 @@ protected:
 
 		++active_bullets_counter;
 
-		multi->set_instance_transform_2d(bullet_index, all_cached_instance_transforms[bullet_index]); // Start rendering the instance
+		set_instance_buffer_transform(bullet_index, all_cached_instance_transforms[bullet_index]); // Start rendering the instance
 
+		set_shape_transform_for_area(bullet_index, all_cached_shape_transforms[bullet_index]); // The shape might have been moved relative to the area while the bullet was disabled
 		physics_server->area_set_shape_disabled(area, bullet_index, false);
 
 		auto &current_bullet_collision_amount = bullets_current_collision_count[bullet_index];
@@ -1193,6 +1617,7 @@ protected:
 		if (!is_active) {
 			is_active = true;
 			set_visible(true);
+			sync_instance_buffer(); // The multimesh might not be processed by the factory right now, so make sure the instance becomes visible immediately
 		}
 	}
 
@@ -1210,10 +1635,11 @@ protected:
 		}
 
 		all_bullets_enabled_set.disable_data(bullet_index);
+		bullet_expiry_wheel.cancel(bullet_index);
 
 		--active_bullets_counter;
 
-		multi->set_instance_transform_2d(bullet_index, zero_transform); // Stops rendering the instance
+		hide_instance_buffer_transform(bullet_index); // Stops rendering the instance
 
 		physics_server->area_set_shape_disabled(area, bullet_index, true);
 
@@ -1221,7 +1647,8 @@ protected:
 			bullet_disable_attachment(bullet_index);
 		}
 
-		if (active_bullets_counter <= 0) {
+		// An emitter stays alive even when all of its bullets have retired
+		if (active_bullets_counter <= 0 && !is_emitter) {
 			disable_multimesh();
 		}
 	}
@@ -1246,6 +1673,16 @@ protected:
 			disable_bullet(bullet_index, false); // Don't disable the attachment yet, first emit the signal for collision so user has access to the attachment and CAN detach it himself inside GDScript
 		}
 
+		// Batched collisions are delivered after the physics frame, so there is nothing to look up or emit now
+		if (bullet_factory->use_collision_batching) {
+			bullet_factory->queue_batched_collision(entered_instance_id, get_instance_id(), bullet_index, all_cached_instance_transforms[bullet_index].get_origin());
+
+			if (bullet_reached_max_collisions) {
+				bullet_disable_attachment(bullet_index);
+			}
+			return;
+		}
+
 		Object *hit_target = ObjectDB::get_instance(entered_instance_id);
 
 		if (collision_type == CollisionType::AREA) {
@@ -1265,17 +1702,17 @@ protected:
 
 	_ALWAYS_INLINE_ void area_entered_func(PhysicsServer2D::AreaBodyStatus status, RID entered_rid, int64_t entered_instance_id, int entered_shape_index, int bullet_shape_index) {
 		if (status == PhysicsServer2D::AREA_BODY_ADDED) {
-			all_collided_bullets.emplace_back(bullet_shape_index, entered_instance_id, CollisionType::AREA);
+			collision_inbox.push(BulletCollisionData2D(bullet_shape_index, entered_instance_id, CollisionType::AREA));
 		}
 	}
 	_ALWAYS_INLINE_ void body_entered_func(PhysicsServer2D::AreaBodyStatus status, RID entered_rid, int64_t entered_instance_id, int entered_shape_index, int bullet_shape_index) {
 		if (status == PhysicsServer2D::AREA_BODY_ADDED) {
-			all_collided_bullets.emplace_back(bullet_shape_index, entered_instance_id, CollisionType::BODY);
+			collision_inbox.push(BulletCollisionData2D(bullet_shape_index, entered_instance_id, CollisionType::BODY));
 		}
 	}
 
 	// Moves a single bullet attachment
-	_ALWAYS_INLINE_ void move_bullet_attachment(const Vector2 &translate_by, int bullet_index) {
+	_ALWAYS_INLINE_ void move_bullet_attachment(const Vector2 &translate_by, int bullet_index, bool is_on_worker_thread = false) {
 		auto &curr_attachment = attachments[bullet_index];
 
 		if (!curr_attachment) {
@@ -1294,8 +1731,8 @@ protected:
 		// Store the new transform as the current one
 		attachment_transforms[bullet_index] = new_attachment_transf;
 
-		// Apply immediately only if not using interpolation
-		if (!bullet_factory->use_physics_interpolation) {
+		// Apply immediately only if not using interpolation (nodes can't be touched from a worker thread, so apply_worker_thread_simulation_results does it later)
+		if (!bullet_factory->use_physics_interpolation && !is_on_worker_thread) {
 			curr_attachment->set_global_transform(new_attachment_transf);
 		}
 	}
@@ -1317,6 +1754,7 @@ protected:
 		curves_elapsed_time = 0.0;
 		if (!value) {
 			current_life_time = max_life_time;
+			is_life_time_expiry_queued = false;
 		}
 	}
 
@@ -1356,7 +1794,7 @@ protected:
 		return true;
 	}
 
-	// Holds custom logic that runs before the spawn function finalizes. Note that the multimesh is not yet added to the scene tree here
+	// Holds custom logic that runs before the spawn function finalizes. Note that the multimesh is not yet added to its bullets container here
 	virtual void custom_additional_spawn_logic(const MultiMeshBulletsData2D &data) {}
 
 	// Holds custom logic that runs before activating this multimesh when retrieved from the object pool
@@ -1369,6 +1807,9 @@ private:
 	// Reserves enough memory and populates all needed data structures keeping track of rotation data
 	void set_rotation_data(const TypedArray<BulletRotationData2D> &rotation_data, bool new_rotate_only_textures);
 
+	// Same as above, but for compiled spawn data
+	void set_rotation_data(const std::vector<CompiledBulletRotationData2D> &rotation_data, bool new_rotate_only_textures);
+
 	// Creates a brand new bullet attachment from the bullet attachment scene and finally saves it to the attachments vector
 	void create_new_bullet_attachment(int bullet_index, const Transform2D &attachment_global_transf);
 
@@ -1376,12 +1817,15 @@ private:
 	Transform2D generate_texture_transform(Transform2D transf, bool is_texture_rotation_permanent, real_t texture_rotation_radians, int bullet_index);
 
 	// Generates a collision shape transform for a particular bullet and attaches it to the area
-	Transform2D generate_collision_shape_transform_for_area(Transform2D transf, const RID &shape, const Vector2 &collision_shape_size, const Vector2 &collision_shape_offset, int bullet_index);
+	Transform2D generate_collision_shape_transform_for_area(Transform2D transf, const Vector2 &collision_shape_offset, int bullet_index);
 
 	// Sets up the area correctly with collision related data
 	void set_up_area(const int collision_layer, const int collision_mask, bool new_monitorable, const RID &physics_space);
 
-	void generate_physics_shapes_for_area(int amount);
+	void generate_physics_shapes_for_area(int amount, const Vector2 &collision_shape_size);
+
+	// Replaces the shape of every bullet with the shared shape of the new size
+	void set_physics_shape_size(const Vector2 &new_collision_shape_size);
 
 	void set_all_physics_shapes_enabled_for_area(bool enable);
 
@@ -1391,6 +1835,27 @@ private:
 
 	void set_up_bullet_instances(const MultiMeshBulletsData2D &data);
 
+	// Turns a freshly spawned multimesh into an emitter - all bullets start retired and the lifetime of the multimesh is ignored
+	void set_up_emitter();
+
+	// Returns a free slot for an emitted bullet or -1 if the emitter is full
+	_ALWAYS_INLINE_ int acquire_emitter_slot() {
+		if (active_bullets_counter >= amount_bullets) {
+			return -1;
+		}
+
+		int slot = emitter_next_slot;
+		while (all_bullets_enabled_set.contains(slot)) {
+			slot = (slot + 1) % amount_bullets;
+		}
+
+		emitter_next_slot = (slot + 1) % amount_bullets;
+		return slot;
+	}
+
+	// Places a bullet that is being emitted into its slot (everything except the movement data, which is handled by the bullet type) and enables it
+	void set_up_emitted_bullet(int bullet_index, const Transform2D &transf);
+
 	void set_up_life_time_timer(double new_max_life_time, double new_current_life_time);
 
 	void set_up_change_texture_timer(int64_t new_amount_textures, double new_default_change_texture_time, const TypedArray<double> &new_change_texture_times);
@@ -1407,12 +1872,28 @@ private:
 			int new_visibility_layer,
 			const Dictionary &new_instance_shader_parameters);
 
+	// Sets the texture only if it's a different one (setting the same texture still redraws the whole multimesh)
+	void set_texture_if_changed(const Ref<Texture2D> &new_texture);
+
+	// Redraws the multimesh with the new texture
+	void set_texture(const Ref<Texture2D> &new_texture);
+
+	// Shows/hides the whole multimesh
+	_ALWAYS_INLINE_ void set_visible(bool new_is_visible) {
+		if (is_visible == new_is_visible) {
+			return;
+		}
+
+		is_visible = new_is_visible;
+		rendering_server->canvas_item_set_visible(canvas_item, is_visible);
+	}
+
 	///
 
 	/// METHODS COMING FROM THE IDebuggerDataProvider2D INTERFACE
 
 	const Vector2 get_collision_shape_size_for_debugging() const override {
-		return static_cast<Vector2>(physics_server->shape_get_data(physics_shapes[0]));
+		return static_cast<Vector2>(physics_server->shape_get_data(physics_shape));
 	}
 
 	const std::vector<Transform2D> &get_all_collision_shape_transforms_for_debugging() const override {
@@ -1424,17 +1905,11 @@ private:
 	}
 
 public:
-	// Timer logic
-	struct CustomTimer {
-		godot::Callable _callback;
-		double _current_time;
-		double _initial_time;
-		bool _repeating;
-		bool _execute_only_if_multimesh_is_active;
-
-		CustomTimer(const godot::Callable &callback, double initial_time, bool repeating, bool execute_only_if_multimesh_is_active) :
-				_callback(callback), _current_time(initial_time), _initial_time(initial_time), _repeating(repeating), _execute_only_if_multimesh_is_active(execute_only_if_multimesh_is_active) {};
-	};
+	// Timer logic - the timers themselves are stored inside the timer scheduler of the factory
+
+	_ALWAYS_INLINE_ uint32_t get_timers_generation() const {
+		return timers_generation;
+	}
 
 	void execute_stored_callable_safely(const Callable &_callback, bool execute_only_if_multimesh_is_active) {
 		call_deferred("_do_execute_stored_callable_safely", _callback, execute_only_if_multimesh_is_active); // call deffered for safety
@@ -1464,7 +1939,7 @@ public:
 			return;
 		}
 
-		multimesh_custom_timers.emplace_back(callable, time, repeat, execute_only_if_multimesh_is_active);
+		bullet_factory->timer_scheduler.schedule(this, callable, time, repeat, execute_only_if_multimesh_is_active);
 	}
 
 	_ALWAYS_INLINE_ void multimesh_detach_time_based_function(const Callable &callable) {
@@ -1472,42 +1947,19 @@ public:
 	}
 
 	_ALWAYS_INLINE_ void _do_detach_time_based_function(const Callable &callable) {
-		for (auto it = multimesh_custom_timers.begin(); it != multimesh_custom_timers.end();) {
-			if (it->_callback == callable) {
-				it = multimesh_custom_timers.erase(it); // Order-preserving
-			} else {
-				++it;
-			}
-		}
+		bullet_factory->timer_scheduler.cancel(get_instance_id(), callable);
 	}
 
 	_ALWAYS_INLINE_ void multimesh_detach_all_time_based_functions() {
 		call_deferred("_do_detach_all_time_based_functions");
 	}
 
+	// Every timer that was attached before this call gets dropped by the scheduler once it comes up, without searching for the timers of this multimesh
 	_ALWAYS_INLINE_ void _do_detach_all_time_based_functions() {
-		multimesh_custom_timers.clear();
-	}
-
-	_ALWAYS_INLINE_ void run_multimesh_custom_timers(double delta) {
-		for (auto it = multimesh_custom_timers.begin(); it != multimesh_custom_timers.end();) {
-			it->_current_time -= delta;
-			if (it->_current_time <= 0.0) {
-				execute_stored_callable_safely(it->_callback, it->_execute_only_if_multimesh_is_active);
-
-				if (it->_repeating) {
-					it->_current_time = it->_initial_time;
-					++it;
-				} else {
-					it = multimesh_custom_timers.erase(it);
-				}
-			} else {
-				++it;
-			}
-		}
+		++timers_generation;
 	}
 
-	// Stores a bunch of timers for the multimesh that should execute
-	std::vector<CustomTimer> multimesh_custom_timers;
+	// Timers are only valid while their generation matches this one
+	uint32_t timers_generation = 0;
 };
 } //namespace BlastBullets2D
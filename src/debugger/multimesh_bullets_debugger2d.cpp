@@ -1,4 +1,5 @@
 #include "multimesh_bullets_debugger2d.hpp"
+#include "../shared/bullets_container2d.hpp"
 #include "godot_cpp/core/memory.hpp"
 
 #include <godot_cpp/classes/engine.hpp>
@@ -13,7 +14,7 @@ using namespace godot;
 
 namespace BlastBullets2D {
 
-void MultiMeshBulletsDebugger2D::configure(Node *new_container_to_debug, const String &new_debugger_name, const Color &new_debugger_color) {
+void MultiMeshBulletsDebugger2D::configure(BulletsContainer2D *new_container_to_debug, const String &new_debugger_name, const Color &new_debugger_color) {
 	physics_server = PhysicsServer2D::get_singleton();
 	container_to_debug = new_container_to_debug;
 	debugger_color = new_debugger_color;
@@ -56,24 +57,17 @@ Color MultiMeshBulletsDebugger2D::get_debugger_color() const {
 
 void MultiMeshBulletsDebugger2D::enable() {
 	// In case the container to debug already has things to debug
-	TypedArray<Node> already_spawned_debugger_data_providers = container_to_debug->get_children();
-	int amount_already_spawned = already_spawned_debugger_data_providers.size();
-
-	if (amount_already_spawned > 0) {
-		debug_data_providers.reserve(amount_already_spawned);
-		debugger_multimeshes.reserve(amount_already_spawned);
-
-		for (int i = 0; i < amount_already_spawned; ++i) {
-			// I first need to extract the actual node from the typed array, since it saves it as a Variant
-			Node *node = Object::cast_to<Node>(already_spawned_debugger_data_providers[i]);
-			if (node) {
-				generate_debug_multimesh(node);
-			}
-		}
+	std::vector<IDebuggerDataProvider2D *> already_spawned_debugger_data_providers;
+	container_to_debug->get_debugger_data_providers(already_spawned_debugger_data_providers);
+
+	debug_data_providers.reserve(already_spawned_debugger_data_providers.size());
+	debugger_multimeshes.reserve(already_spawned_debugger_data_providers.size());
+
+	for (IDebuggerDataProvider2D *debugger_data_provider : already_spawned_debugger_data_providers) {
+		generate_debug_multimesh(debugger_data_provider);
 	}
 
-	// Add a function that runs whenever a new child gets added to the container to debug / when the child_entered_tree signal gets emitted
-	container_to_debug->connect("child_entered_tree", callable_mp(this, &MultiMeshBulletsDebugger2D::generate_debug_multimesh));
+	// Everything that gets added to the container from now on is handed over by the container through add_debugger_data_provider
 
 	set_physics_process(true);
 	is_debugger_enabled = true;
@@ -83,10 +77,6 @@ void MultiMeshBulletsDebugger2D::disable() {
 	set_physics_process(false);
 	is_debugger_enabled = false;
 
-	// Disconnect the function that runs whenever a new child gets added to the container to debug / when the child_entered_tree signal gets emitted
-	container_to_debug->disconnect("child_entered_tree", callable_mp(this, &MultiMeshBulletsDebugger2D::generate_debug_multimesh));
-	// Note: If you ever see a "trying to disconnect a signal that wasn't actually connected before" type of error message in the godot console, it means that your object state is not valid. Ensure you always initialize variables that you may access for the first time (variables accessed without actually calling the setter first = accessing undefined value = undefined behavior)..
-
 	for (int i = 0; i < debugger_multimeshes.size(); ++i) {
 		memdelete(debugger_multimeshes[i]); // basically a forceful freeing instead of the usual queue_free, should be safe as long as those multimeshes don't do anything additional that is related to physics_process
 	}
@@ -96,15 +86,15 @@ void MultiMeshBulletsDebugger2D::disable() {
 	debug_data_providers.clear();
 }
 
-void MultiMeshBulletsDebugger2D::generate_debug_multimesh(Node *node_entered_container_to_debug) {
-	IDebuggerDataProvider2D *debugger_data_provider = dynamic_cast<IDebuggerDataProvider2D *>(node_entered_container_to_debug); // I wish I could static_cast this but not possible since im using godot engine signals and they require actual Node objects (which have no relationship to my custom interface class)
-
-	// In case the user added something else to the container_to_debug, it should typically hold only IDebuggerDataProvider2D, othwerwise weird behavior and other errors might occur
-	if (!debugger_data_provider) {
-		UtilityFunctions::push_error("Error. The node that entered the container to debug is not of type IDebuggerDataProvider2D. Never attach additional nodes to the bullets debugger.");
+void MultiMeshBulletsDebugger2D::add_debugger_data_provider(IDebuggerDataProvider2D *debugger_data_provider) {
+	if (!is_debugger_enabled) {
 		return;
 	}
 
+	generate_debug_multimesh(debugger_data_provider);
+}
+
+void MultiMeshBulletsDebugger2D::generate_debug_multimesh(IDebuggerDataProvider2D *debugger_data_provider) {
 	// The physics server in Godot creates shape sizes by half extents when dealing with RectangleShape and it also returns half extents every time you use shape_get_data or shape_set_data..
 	// Example: If the debugger_data_provider rectangle shape was originally created using shape_set_data with argument Vector2(16,16) this would mean that Godot has created a shape with half the width being 16 and half the height being also 16, meaning we are dealing with a rectangle shape with the actual size of Vector2(32,32)
 	// So because shape_get_data returns the half extents, I need to multiply it by 2 to get the actual size that the QuadMesh I'm trying to create will have (this is so I can use a QuadMesh to represent the actual bullet collision shape)
@@ -12,6 +12,8 @@ class PhysicsServer2D;
 namespace BlastBullets2D {
 using namespace godot;
 
+class BulletsContainer2D;
+
 // Visualizes the collision shapes of the bullets
 class MultiMeshBulletsDebugger2D : public Node {
 	GDCLASS(MultiMeshBulletsDebugger2D, Node)
@@ -20,8 +22,11 @@ public:
 	// Handles movement of the debug multimeshes
 	virtual void _physics_process(double delta) override;
 
-	// Configures the debugger so that it's in valid state. It's mandatory to call this method since it acts as a second constructor. Also mandatory that the new_container_to_debug holds only IDebuggerDataProvider2D children and only IDebuggerDataProvider2D get spawned there throughout its lifetime
-	void configure(Node *new_container_to_debug, const String &new_debugger_name, const Color &new_debugger_color);
+	// Configures the debugger so that it's in valid state. It's mandatory to call this method since it acts as a second constructor
+	void configure(BulletsContainer2D *new_container_to_debug, const String &new_debugger_name, const Color &new_debugger_color);
+
+	// Starts debugging a data provider that was added to the container to debug after the debugger got enabled. Does nothing while the debugger is disabled
+	void add_debugger_data_provider(IDebuggerDataProvider2D *debugger_data_provider);
 
 	// Get whether the debugger is enabled or not
 	bool get_is_debugger_enabled() const;
@@ -51,14 +56,14 @@ private:
 	// Stores pointers to the spawned debug multimeshes
 	std::vector<MultiMeshInstance2D *> debugger_multimeshes;
 
-	// A pointer to where the IDebuggerDataProvider2D nodes are stored
-	Node *container_to_debug = nullptr;
+	// A pointer to where the IDebuggerDataProvider2D objects are stored
+	BulletsContainer2D *container_to_debug = nullptr;
 
 	// A pointer to the physics server
 	PhysicsServer2D *physics_server = nullptr;
 
-	// Generates a debug multimesh from a node that should inherit from IDebuggerDataProvider2D
-	void generate_debug_multimesh(Node *node_entered_container_to_debug);
+	// Generates a debug multimesh for a IDebuggerDataProvider2D
+	void generate_debug_multimesh(IDebuggerDataProvider2D *debugger_data_provider);
 
 	// Ensures that the quadmesh amount_bullets of a debug multimesh matches the amount_bullets of the collision shapes of a IDebuggerDataProvider2D
 	void ensure_quadmesh_matches_data_provider_collision_shape_size(MultiMeshInstance2D &debug_multimesh_instance, IDebuggerDataProvider2D &debugger_data_provider);
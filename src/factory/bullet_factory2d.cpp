@@ -61,6 +61,20 @@ void BulletFactory2D::_ready() {
 	is_ready = true;
 }
 
+void BulletFactory2D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_PREDELETE: {
+			if (!is_ready) {
+				break;
+			}
+
+			// Has to happen while the bullet containers, the attachments container and the shared resources still exist
+			free_all_bullets_helper<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool);
+			free_all_bullets_helper<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool);
+		} break;
+	}
+}
+
 bool BulletFactory2D::get_use_physics_interpolation() const {
 	if (!is_ready) {
 		return use_physics_interpolation_cached_before_ready;
@@ -110,16 +124,236 @@ void BulletFactory2D::set_use_physics_interpolation_editor(bool new_use_physics_
 	use_physics_interpolation_cached_before_ready = new_use_physics_interpolation;
 }
 
-void BulletFactory2D::add_bullet_containers() {
-	// Create BlockBulletsContainer Node and add it as a child to factory
-	block_bullets_container = memnew(Node);
-	block_bullets_container->set_name("BlockBulletsContainer");
-	add_child(block_bullets_container);
+bool BulletFactory2D::get_use_multithreading() const {
+	return use_multithreading;
+}
+
+void BulletFactory2D::set_use_multithreading(bool value) {
+	use_multithreading = value;
+}
+
+bool BulletFactory2D::get_use_collision_grid() const {
+	return use_collision_grid;
+}
+
+void BulletFactory2D::set_use_collision_grid(bool value) {
+	// Bullets that were spawned while the grid was used have their areas outside of the physics space, so they have to be handed back to the physics server or they would never collide again
+	if (use_collision_grid && !value) {
+		for (DirectionalBullets2D *multi : all_directional_bullets) {
+			multi->stop_using_collision_grid(physics_space);
+		}
+
+		for (BlockBullets2D *multi : all_block_bullets) {
+			multi->stop_using_collision_grid(physics_space);
+		}
+
+		collision_grid.clear_overlaps();
+	}
+
+	use_collision_grid = value;
+}
+
+real_t BulletFactory2D::get_collision_grid_cell_size() const {
+	return collision_grid.cell_size;
+}
+
+void BulletFactory2D::set_collision_grid_cell_size(real_t new_cell_size) {
+	if (new_cell_size < 1.0) {
+		UtilityFunctions::push_error("Error when trying to set collision_grid_cell_size. The cell size must be at least 1. Ignoring the request");
+		return;
+	}
+
+	collision_grid.cell_size = new_cell_size;
+}
+
+void BulletFactory2D::collision_grid_add_target(Node2D *target, const Vector2 &size, int collision_layer, bool is_body) {
+	if (target == nullptr) {
+		UtilityFunctions::push_error("Error when trying to add a collision grid target. The target is null. Ignoring the request");
+		return;
+	}
+
+	collision_grid.add_target(target, size, static_cast<uint32_t>(collision_layer), is_body);
+}
+
+void BulletFactory2D::collision_grid_add_target_rid(const RID &target_rid, const Vector2 &size, int collision_layer, bool is_body) {
+	if (!target_rid.is_valid()) {
+		UtilityFunctions::push_error("Error when trying to add a collision grid target. The RID is invalid. Ignoring the request");
+		return;
+	}
+
+	collision_grid.add_target_rid(target_rid, size, static_cast<uint32_t>(collision_layer), is_body);
+}
+
+void BulletFactory2D::collision_grid_remove_target(Node2D *target) {
+	collision_grid.remove_target(target);
+}
+
+void BulletFactory2D::collision_grid_remove_target_rid(const RID &target_rid) {
+	collision_grid.remove_target_rid(target_rid);
+}
+
+void BulletFactory2D::collision_grid_clear_targets() {
+	collision_grid.clear_targets();
+}
 
-	// Create DirectionalBulletsContainer Node and add it as a child to factory
-	directional_bullets_container = memnew(Node);
-	directional_bullets_container->set_name("DirectionalBulletsContainer");
-	add_child(directional_bullets_container);
+int BulletFactory2D::collision_grid_get_targets_amount() const {
+	return collision_grid.get_targets_amount();
+}
+
+bool BulletFactory2D::get_use_bullets_pool_size_classes() const {
+	return use_bullets_pool_size_classes;
+}
+
+void BulletFactory2D::set_use_bullets_pool_size_classes(bool value) {
+	use_bullets_pool_size_classes = value;
+	update_bullets_pool_size_classes();
+}
+
+PackedInt32Array BulletFactory2D::get_bullets_pool_size_classes() const {
+	return bullets_pool_size_classes;
+}
+
+void BulletFactory2D::set_bullets_pool_size_classes(const PackedInt32Array &new_size_classes) {
+	bullets_pool_size_classes = new_size_classes;
+	update_bullets_pool_size_classes();
+}
+
+void BulletFactory2D::update_bullets_pool_size_classes() {
+	std::vector<int> size_class_ladder(bullets_pool_size_classes.ptr(), bullets_pool_size_classes.ptr() + bullets_pool_size_classes.size());
+
+	directional_bullets_pool.set_size_classes(use_bullets_pool_size_classes, size_class_ladder);
+	block_bullets_pool.set_size_classes(use_bullets_pool_size_classes, size_class_ladder);
+
+	// Pooled multimeshes that were allocated with a size class of the old ladder can never be popped again, so free them
+	if (is_factory_busy) {
+		UtilityFunctions::push_warning("The bullets pool size classes were changed while BulletFactory2D is busy. Pooled multimeshes of the old size classes will be kept until the pool is freed.");
+		return;
+	}
+
+	free_unreachable_pooled_bullets_helper<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool, directional_bullets_pool_usage);
+	free_unreachable_pooled_bullets_helper<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool, block_bullets_pool_usage);
+}
+
+bool BulletFactory2D::get_use_bullets_pool_auto_tuning() const {
+	return use_bullets_pool_auto_tuning;
+}
+
+void BulletFactory2D::set_use_bullets_pool_auto_tuning(bool value) {
+	use_bullets_pool_auto_tuning = value;
+
+	if (!use_bullets_pool_auto_tuning) {
+		// Don't keep the spawn data (and everything it references) alive
+		directional_bullets_pool_usage.clear();
+		block_bullets_pool_usage.clear();
+		bullets_pool_auto_tuning_window_time = 0.0;
+	}
+}
+
+double BulletFactory2D::get_bullets_pool_auto_tuning_window() const {
+	return bullets_pool_auto_tuning_window;
+}
+
+void BulletFactory2D::set_bullets_pool_auto_tuning_window(double value) {
+	bullets_pool_auto_tuning_window = Math::max(value, 0.0);
+}
+
+double BulletFactory2D::get_bullets_pool_auto_tuning_headroom() const {
+	return bullets_pool_auto_tuning_headroom;
+}
+
+void BulletFactory2D::set_bullets_pool_auto_tuning_headroom(double value) {
+	bullets_pool_auto_tuning_headroom = Math::max(value, 0.0);
+}
+
+double BulletFactory2D::get_bullets_pool_auto_tuning_idle_time() const {
+	return bullets_pool_auto_tuning_idle_time;
+}
+
+void BulletFactory2D::set_bullets_pool_auto_tuning_idle_time(double value) {
+	bullets_pool_auto_tuning_idle_time = Math::max(value, 0.0);
+}
+
+int BulletFactory2D::get_bullets_pool_auto_tuning_budget_usec() const {
+	return bullets_pool_auto_tuning_budget_usec;
+}
+
+void BulletFactory2D::set_bullets_pool_auto_tuning_budget_usec(int value) {
+	bullets_pool_auto_tuning_budget_usec = Math::max(value, 0);
+}
+
+bool BulletFactory2D::get_use_collision_batching() const {
+	return use_collision_batching;
+}
+
+void BulletFactory2D::set_use_collision_batching(bool value) {
+	use_collision_batching = value;
+}
+
+PackedInt64Array BulletFactory2D::get_collisions_batch_target_instance_ids() const {
+	return collisions_batch_target_instance_ids;
+}
+
+PackedInt64Array BulletFactory2D::get_collisions_batch_multimesh_instance_ids() const {
+	return collisions_batch_multimesh_instance_ids;
+}
+
+PackedInt32Array BulletFactory2D::get_collisions_batch_bullet_indexes() const {
+	return collisions_batch_bullet_indexes;
+}
+
+PackedVector2Array BulletFactory2D::get_collisions_batch_bullet_positions() const {
+	return collisions_batch_bullet_positions;
+}
+
+int BulletFactory2D::get_collisions_batch_amount() const {
+	return static_cast<int>(collisions_batch_bullet_indexes.size());
+}
+
+void BulletFactory2D::flush_collisions_batch() {
+	const int amount_collisions = static_cast<int>(batched_bullet_indexes.size());
+
+	// The pull API always returns the collisions of the last physics frame, so a frame without collisions leaves the batch empty
+	collisions_batch_target_instance_ids.resize(amount_collisions);
+	collisions_batch_multimesh_instance_ids.resize(amount_collisions);
+	collisions_batch_bullet_indexes.resize(amount_collisions);
+	collisions_batch_bullet_positions.resize(amount_collisions);
+
+	if (amount_collisions == 0) {
+		return;
+	}
+
+	std::copy(batched_target_instance_ids.begin(), batched_target_instance_ids.end(), collisions_batch_target_instance_ids.ptrw());
+	std::copy(batched_multimesh_instance_ids.begin(), batched_multimesh_instance_ids.end(), collisions_batch_multimesh_instance_ids.ptrw());
+	std::copy(batched_bullet_indexes.begin(), batched_bullet_indexes.end(), collisions_batch_bullet_indexes.ptrw());
+	std::copy(batched_bullet_positions.begin(), batched_bullet_positions.end(), collisions_batch_bullet_positions.ptrw());
+
+	batched_target_instance_ids.clear();
+	batched_multimesh_instance_ids.clear();
+	batched_bullet_indexes.clear();
+	batched_bullet_positions.clear();
+
+	emit_signal("collisions_batch", collisions_batch_target_instance_ids, collisions_batch_multimesh_instance_ids, collisions_batch_bullet_indexes, collisions_batch_bullet_positions);
+}
+
+void BulletFactory2D::handle_collision_grid() {
+	collision_grid.begin_frame();
+
+	for (int index : directional_bullets_set.get_active_indexes()) {
+		all_directional_bullets[index]->insert_bullets_into_collision_grid(collision_grid);
+	}
+
+	for (int index : block_bullets_set.get_active_indexes()) {
+		all_block_bullets[index]->insert_bullets_into_collision_grid(collision_grid);
+	}
+
+	collision_grid.detect_collisions();
+	collision_grid.handle_detected_collisions();
+}
+
+void BulletFactory2D::add_bullet_containers() {
+	// Same canvas that a child node of the factory would be drawn on
+	block_bullets_container.create(get_canvas());
+	directional_bullets_container.create(get_canvas());
 }
 
 void BulletFactory2D::add_bullet_attachment_container() {
@@ -132,12 +366,14 @@ void BulletFactory2D::add_bullet_attachment_container() {
 void BulletFactory2D::add_debuggers() {
 	// Configure BlockBullets2D debugger and add it as a child to factory
 	block_bullets_debugger = memnew(MultiMeshBulletsDebugger2D);
-	block_bullets_debugger->configure(block_bullets_container, "BlockBulletsDebugger", block_bullets_debugger_color_cached_before_ready);
+	block_bullets_debugger->configure(&block_bullets_container, "BlockBulletsDebugger", block_bullets_debugger_color_cached_before_ready);
+	block_bullets_container.set_debugger(block_bullets_debugger);
 	add_child(block_bullets_debugger);
 
 	// Configure DirectionalBullets2D debugger and add it as a child to factory
 	directional_bullets_debugger = memnew(MultiMeshBulletsDebugger2D);
-	directional_bullets_debugger->configure(directional_bullets_container, "DirectionalBulletsDebugger", directional_bullets_debugger_color_cached_before_ready);
+	directional_bullets_debugger->configure(&directional_bullets_container, "DirectionalBulletsDebugger", directional_bullets_debugger_color_cached_before_ready);
+	directional_bullets_container.set_debugger(directional_bullets_debugger);
 	add_child(directional_bullets_debugger);
 }
 
@@ -167,18 +403,150 @@ void BulletFactory2D::_physics_process(double delta) {
 	handle_bullet_behavior<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, delta);
 	handle_bullet_behavior<BlockBullets2D>(all_block_bullets, block_bullets_set, delta);
 
-	for (auto &bullet : all_directional_bullets) {
-		bullet->run_multimesh_custom_timers(delta);
+	// The collisions are detected after every bullet has moved, same as the physics server would
+	if (use_collision_grid) {
+		handle_collision_grid();
 	}
+
+	timer_scheduler.advance(delta);
+
+	flush_collisions_batch();
 }
 
 void BulletFactory2D::_process(double delta) {
-	if (!use_physics_interpolation) {
+	handle_bullet_rendering<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set);
+	handle_bullet_rendering<BlockBullets2D>(all_block_bullets, block_bullets_set);
+
+	is_debugger_paused_this_frame = false;
+
+	if (!bullets_pool_tasks.empty()) {
+		handle_bullets_pool_tasks();
+	}
+
+	if (use_bullets_pool_auto_tuning) {
+		handle_bullets_pool_auto_tuning(delta);
+	}
+}
+
+void BulletFactory2D::handle_bullets_pool_tasks() {
+	if (is_factory_busy) {
 		return;
 	}
 
-	handle_bullet_rendering_interpolation<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set);
-	handle_bullet_rendering_interpolation<BlockBullets2D>(all_block_bullets, block_bullets_set);
+	Time *time = Time::get_singleton();
+
+	const uint64_t budget_end_usec = time->get_ticks_usec() + static_cast<uint64_t>(bullets_pool_tasks.front().budget_usec);
+
+	// Always do at least one step, so that even a task with a tiny budget finishes at some point
+	bool is_first_step = true;
+
+	while (!bullets_pool_tasks.empty()) {
+		BulletsPoolTask &task = bullets_pool_tasks.front();
+		const int amount_done_before = task.amount_done;
+
+		bool is_finished = task.amount_done >= task.amount_total;
+
+		while (!is_finished && (is_first_step || time->get_ticks_usec() < budget_end_usec)) {
+			is_first_step = false;
+
+			if (!step_bullets_pool_task(task)) {
+				// Nothing left to do (e.g. the pool got emptied some other way)
+				task.amount_total = task.amount_done;
+				is_finished = true;
+				break;
+			}
+
+			++task.amount_done;
+			is_finished = task.amount_done >= task.amount_total;
+		}
+
+		const int task_id = task.id;
+		const int amount_done = task.amount_done;
+		const int amount_total = task.amount_total;
+
+		// Remove the task before emitting, the user might queue/cancel tasks from inside the signal callbacks
+		if (is_finished) {
+			bullets_pool_tasks.pop_front();
+		}
+
+		if (amount_done != amount_done_before) {
+			emit_signal("bullets_pool_task_progress", task_id, amount_done, amount_total);
+		}
+
+		if (!is_finished) {
+			return; // out of time, continue next frame
+		}
+
+		emit_signal("bullets_pool_task_finished", task_id);
+	}
+}
+
+bool BulletFactory2D::step_bullets_pool_task(BulletsPoolTask &task) {
+	if (task.is_populate) {
+		// The spawn data could have been changed since the task was queued. Compiled data (e.g. a pattern) is pooled for spawning it as a template
+		const bool use_compiled_data = task.spawn_data->get_is_compiled();
+		const int amount_bullets_per_instance = task.spawn_data->get_amount_bullets_to_spawn(use_compiled_data);
+		if (amount_bullets_per_instance == 0) {
+			return false;
+		}
+
+		pause_debugger_until_next_frame();
+
+		switch (task.bullet_type) {
+			case BulletFactory2D::DIRECTIONAL_BULLETS:
+				populate_bullets_pool_helper<DirectionalBullets2D>(task.spawn_data, all_directional_bullets, directional_bullets_pool, directional_bullets_container, 1, amount_bullets_per_instance, use_compiled_data);
+				break;
+			case BulletFactory2D::BLOCK_BULLETS:
+				populate_bullets_pool_helper<BlockBullets2D>(task.spawn_data, all_block_bullets, block_bullets_pool, block_bullets_container, 1, amount_bullets_per_instance, use_compiled_data);
+				break;
+			default:
+				return false;
+		}
+
+		return true;
+	}
+
+	switch (task.bullet_type) {
+		case BulletFactory2D::DIRECTIONAL_BULLETS:
+			return free_single_pooled_multimesh_helper<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool, task.amount_bullets_per_instance);
+		case BulletFactory2D::BLOCK_BULLETS:
+			return free_single_pooled_multimesh_helper<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool, task.amount_bullets_per_instance);
+		default:
+			return false;
+	}
+}
+
+void BulletFactory2D::handle_bullets_pool_auto_tuning(double delta) {
+	if (is_factory_busy) {
+		return;
+	}
+
+	bullets_pool_auto_tuning_window_time += delta;
+
+	const bool is_new_window = bullets_pool_auto_tuning_window_time >= bullets_pool_auto_tuning_window;
+	if (is_new_window) {
+		bullets_pool_auto_tuning_window_time = 0.0;
+	}
+
+	// The usage of every size class of both bullet types is updated before any growing/trimming, so the windows advance even when the time budget runs out
+	update_bullets_pool_usage<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool, directional_bullets_pool_usage, is_new_window);
+	update_bullets_pool_usage<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool, block_bullets_pool_usage, is_new_window);
+
+	const uint64_t budget_end_usec = Time::get_singleton()->get_ticks_usec() + static_cast<uint64_t>(Math::max(bullets_pool_auto_tuning_budget_usec, 0));
+
+	const bool block_bullets_first = auto_tune_block_bullets_first;
+	auto_tune_block_bullets_first = !auto_tune_block_bullets_first;
+
+	// Whatever doesn't fit in the time budget is simply done during the next frames
+	if (block_bullets_first) {
+		if (auto_tune_bullets_pool<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool, block_bullets_pool_usage, block_bullets_container, budget_end_usec)) {
+			auto_tune_bullets_pool<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool, directional_bullets_pool_usage, directional_bullets_container, budget_end_usec);
+		}
+	} else {
+		if (auto_tune_bullets_pool<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool, directional_bullets_pool_usage, directional_bullets_container, budget_end_usec)) {
+			auto_tune_bullets_pool<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool, block_bullets_pool_usage, block_bullets_container, budget_end_usec);
+		}
+	}
 }
 
 void BulletFactory2D::spawn_block_bullets(const Ref<BlockBulletsData2D> &spawn_data) {
@@ -187,7 +555,7 @@ void BulletFactory2D::spawn_block_bullets(const Ref<BlockBulletsData2D> &spawn_d
 		return;
 	}
 
-	if (spawn_data->transforms.size() == 0) {
+	if (spawn_data->get_amount_bullets_to_spawn(false) == 0) {
 		UtilityFunctions::push_error("Error when trying to spawn BlockBullets2D. No transforms were provided in the spawn data. Ignoring the request");
 		return;
 	}
@@ -196,6 +564,7 @@ void BulletFactory2D::spawn_block_bullets(const Ref<BlockBulletsData2D> &spawn_d
 			all_block_bullets,
 			block_bullets_set,
 			block_bullets_pool,
+			block_bullets_pool_usage,
 			block_bullets_container,
 			spawn_data);
 }
@@ -206,7 +575,7 @@ void BulletFactory2D::spawn_directional_bullets(const Ref<DirectionalBulletsData
 		return;
 	}
 
-	if (spawn_data->transforms.size() == 0) {
+	if (spawn_data->get_amount_bullets_to_spawn(false) == 0) {
 		UtilityFunctions::push_error("Error when trying to spawn DirectionalBullets2D. No transforms were provided in the spawn data. Ignoring the request");
 		return;
 	}
@@ -215,6 +584,7 @@ void BulletFactory2D::spawn_directional_bullets(const Ref<DirectionalBulletsData
 			all_directional_bullets,
 			directional_bullets_set,
 			directional_bullets_pool,
+			directional_bullets_pool_usage,
 			directional_bullets_container,
 			spawn_data,
 			new_inherited_velocity_offset);
@@ -226,7 +596,7 @@ DirectionalBullets2D *BulletFactory2D::spawn_controllable_directional_bullets(co
 		return nullptr;
 	}
 
-	if (spawn_data->transforms.size() == 0) {
+	if (spawn_data->get_amount_bullets_to_spawn(false) == 0) {
 		UtilityFunctions::push_error("Error when trying to spawn DirectionalBullets2D. No transforms were provided in the spawn data. Ignoring the request");
 		return nullptr;
 	}
@@ -235,11 +605,133 @@ DirectionalBullets2D *BulletFactory2D::spawn_controllable_directional_bullets(co
 			all_directional_bullets,
 			directional_bullets_set,
 			directional_bullets_pool,
+			directional_bullets_pool_usage,
 			directional_bullets_container,
 			spawn_data,
 			new_inherited_velocity_offset);
 }
 
+bool BulletFactory2D::validate_spawn_template(const Ref<MultiMeshBulletsData2D> &spawn_template, const String &bullets_class_name) {
+	if (is_factory_busy) {
+		UtilityFunctions::push_error("Error when trying to spawn bullets. BulletFactory2D is currently busy. Ignoring the request");
+		return false;
+	}
+
+	if (spawn_template.is_null()) {
+		UtilityFunctions::push_error("Error when trying to spawn " + bullets_class_name + " from a template. The template is null. Ignoring the request");
+		return false;
+	}
+
+	if (!spawn_template->get_is_compiled()) {
+		UtilityFunctions::push_error("Error when trying to spawn " + bullets_class_name + " from a template. The template is not compiled, call compile() after changing its data. Ignoring the request");
+		return false;
+	}
+
+	if (spawn_template->get_amount_bullets_to_spawn(true) == 0) {
+		UtilityFunctions::push_error("Error when trying to spawn " + bullets_class_name + " from a template. No transforms were provided in the template. Ignoring the request");
+		return false;
+	}
+
+	return true;
+}
+
+void BulletFactory2D::spawn_directional_bullets_from_template(const Ref<DirectionalBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians, const Vector2 &new_inherited_velocity_offset) {
+	if (!validate_spawn_template(spawn_template, "DirectionalBullets2D")) {
+		return;
+	}
+
+	spawn_bullets_helper<DirectionalBullets2D, DirectionalBulletsData2D>(
+			all_directional_bullets,
+			directional_bullets_set,
+			directional_bullets_pool,
+			directional_bullets_pool_usage,
+			directional_bullets_container,
+			spawn_template,
+			new_inherited_velocity_offset,
+			Transform2D(rotation_radians, origin),
+			true);
+}
+
+void BulletFactory2D::spawn_block_bullets_from_template(const Ref<BlockBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians) {
+	if (!validate_spawn_template(spawn_template, "BlockBullets2D")) {
+		return;
+	}
+
+	spawn_bullets_helper<BlockBullets2D, BlockBulletsData2D>(
+			all_block_bullets,
+			block_bullets_set,
+			block_bullets_pool,
+			block_bullets_pool_usage,
+			block_bullets_container,
+			spawn_template,
+			Vector2(0, 0),
+			Transform2D(rotation_radians, origin),
+			true);
+}
+
+DirectionalBullets2D *BulletFactory2D::spawn_controllable_directional_bullets_from_template(const Ref<DirectionalBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians, const Vector2 &new_inherited_velocity_offset) {
+	if (!validate_spawn_template(spawn_template, "DirectionalBullets2D")) {
+		return nullptr;
+	}
+
+	return spawn_bullets_helper<DirectionalBullets2D, DirectionalBulletsData2D>(
+			all_directional_bullets,
+			directional_bullets_set,
+			directional_bullets_pool,
+			directional_bullets_pool_usage,
+			directional_bullets_container,
+			spawn_template,
+			new_inherited_velocity_offset,
+			Transform2D(rotation_radians, origin),
+			true);
+}
+
+DirectionalBullets2D *BulletFactory2D::spawn_directional_bullets_emitter(const Ref<DirectionalBulletsData2D> &spawn_data, const Vector2 &new_inherited_velocity_offset) {
+	if (is_factory_busy) {
+		UtilityFunctions::push_error("Error when trying to spawn a bullets emitter. BulletFactory2D is currently busy. Ignoring the request");
+		return nullptr;
+	}
+
+	// An emitter is set up from the compiled arrays whenever the spawn data is compiled
+	const bool use_compiled_data = spawn_data.is_valid() && spawn_data->get_is_compiled();
+
+	if (spawn_data.is_null() || spawn_data->get_amount_bullets_to_spawn(use_compiled_data) == 0) {
+		UtilityFunctions::push_error("Error when trying to spawn a bullets emitter. No transforms were provided in the spawn data. Ignoring the request");
+		return nullptr;
+	}
+
+	const int amount_bullets_capacity = spawn_data->get_amount_bullets_to_spawn(use_compiled_data);
+	const int sparse_set_id = all_directional_bullets.size();
+
+	// An emitter is always brand new - it has to stay alive for as long as it's used, so it never comes from (or goes to) the object pool
+	DirectionalBullets2D *emitter = memnew(DirectionalBullets2D);
+	emitter->spawn(*spawn_data.ptr(), &directional_bullets_pool, this, directional_bullets_container, new_inherited_velocity_offset, sparse_set_id, false, amount_bullets_capacity, Transform2D(), use_compiled_data);
+	emitter->set_up_emitter();
+
+	all_directional_bullets.emplace_back(emitter);
+	directional_bullets_set.activate_data(sparse_set_id);
+
+	return emitter;
+}
+
+void BulletFactory2D::free_bullets_emitter(DirectionalBullets2D *emitter) {
+	if (is_factory_busy) {
+		UtilityFunctions::push_error("Error when trying to free a bullets emitter. BulletFactory2D is currently busy. Ignoring the request");
+		return;
+	}
+
+	if (emitter == nullptr || !emitter->get_is_emitter()) {
+		UtilityFunctions::push_error("Error when trying to free a bullets emitter. The DirectionalBullets2D is not an emitter. Ignoring the request");
+		return;
+	}
+
+	pause_debugger_until_next_frame();
+
+	directional_bullets_set.disable_data(emitter->sparse_set_id);
+	remove_multimesh_instance_from_vec_and_sparse_set<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, emitter);
+	emitter->force_delete();
+}
+
 void BulletFactory2D::reset_factory_state(int amount_bullets) {
 	// Check if debuggers are enabled
 	bool debugger_curr_enabled = get_is_debugger_enabled();
@@ -251,14 +743,39 @@ void BulletFactory2D::reset_factory_state(int amount_bullets) {
 	}
 
 	// Free all DirectionalBullets2D, their attachments and the object pool
-	free_all_bullets_helper<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool, amount_bullets);
+	free_all_bullets_helper<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool, directional_bullets_pool.get_size_class(amount_bullets));
 
 	// Free all BlockBullets2D, their attachments and the object pool
-	free_all_bullets_helper<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool, amount_bullets);
+	free_all_bullets_helper<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool, block_bullets_pool.get_size_class(amount_bullets));
 
 	// Free all bullet attachments that are currently in the object pool
 	bullet_attachments_pool.free_all_bullet_attachments();
 
+	// The freed bullets can no longer be overlapping anything
+	collision_grid.clear_overlaps();
+
+	// Forget collisions of bullets that no longer exist
+	batched_target_instance_ids.clear();
+	batched_multimesh_instance_ids.clear();
+	batched_bullet_indexes.clear();
+	batched_bullet_positions.clear();
+
+	collisions_batch_target_instance_ids.clear();
+	collisions_batch_multimesh_instance_ids.clear();
+	collisions_batch_bullet_indexes.clear();
+	collisions_batch_bullet_positions.clear();
+
+	// Unfinished populate/free tasks would work on bullets that no longer exist
+	bullets_pool_tasks.clear();
+
+	// The timers belong to multimeshes that were freed
+	timer_scheduler.clear();
+
+	// The pools are empty now, so the auto tuning starts from scratch
+	directional_bullets_pool_usage.clear();
+	block_bullets_pool_usage.clear();
+	bullets_pool_auto_tuning_window_time = 0.0;
+
 	// If the debuggers are supposed to be enabled then re-enable them
 	if (debugger_curr_enabled) {
 		block_bullets_debugger->set_is_debugger_enabled(true);
@@ -311,10 +828,10 @@ void BulletFactory2D::free_active_bullets(int amount_bullets) {
 	}
 
 	// Free all ACTIVE DirectionalBullets2D
-	free_only_active_bullets_helper<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, amount_bullets);
+	free_only_active_bullets_helper<DirectionalBullets2D>(all_directional_bullets, directional_bullets_set, directional_bullets_pool.get_size_class(amount_bullets));
 
 	// Free all ACTIVE BlockBullets2D
-	free_only_active_bullets_helper<BlockBullets2D>(all_block_bullets, block_bullets_set, amount_bullets);
+	free_only_active_bullets_helper<BlockBullets2D>(all_block_bullets, block_bullets_set, block_bullets_pool.get_size_class(amount_bullets));
 
 	// If the debuggers are supposed to be enabled then re-enable them
 	if (debugger_curr_enabled) {
@@ -348,13 +865,13 @@ void BulletFactory2D::free_disabled_bullets(int amount_bullets) {
 			all_directional_bullets,
 			directional_bullets_set,
 			directional_bullets_pool,
-			amount_bullets);
+			directional_bullets_pool.get_size_class(amount_bullets));
 
 	free_only_disabled_bullets_helper<BlockBullets2D>(
 			all_block_bullets,
 			block_bullets_set,
 			block_bullets_pool,
-			amount_bullets);
+			block_bullets_pool.get_size_class(amount_bullets));
 
 	if (debugger_curr_enabled) {
 		block_bullets_debugger->set_is_debugger_enabled(true);
@@ -385,7 +902,7 @@ void BulletFactory2D::handle_manual_user_deletion_of_multimesh_bullets(MultiMesh
 
 	DirectionalBullets2D *dir_ptr = dynamic_cast<DirectionalBullets2D *>(&bullet_multi);
 	BlockBullets2D *block_ptr = dynamic_cast<BlockBullets2D *>(&bullet_multi);
-	int amount = bullet_multi.get_amount_bullets();
+	int amount = bullet_multi.get_amount_bullets_capacity();
 
 	if (dir_ptr) {
 		directional_bullets_pool.try_remove_instance(dir_ptr, amount);
@@ -411,22 +928,17 @@ void BulletFactory2D::populate_bullets_pool(const Ref<MultiMeshBulletsData2D> &m
 		return;
 	}
 
-	is_factory_busy = true;
-
-	bool enable_processing_after_finish = is_factory_processing_bullets;
-	set_is_factory_processing_bullets(false);
-
-	bool debugger_was_enabled = get_is_debugger_enabled();
-	if (debugger_was_enabled) {
-		set_is_debugger_enabled(false);
-	}
-
+	// Validate before marking the factory as busy, otherwise an invalid request would leave it busy forever
 	if (amount_instances <= 0) {
 		UtilityFunctions::push_error("Error. You can't populate the bullets pool with amount_instances <= 0");
 		return;
 	}
 
-	if (multimesh_data->transforms.size() == 0) {
+	// Compiled data (e.g. a pattern) is pooled for spawning it as a template
+	const bool use_compiled_data = multimesh_data->get_is_compiled();
+	const int amount_bullets_per_instance = multimesh_data->get_amount_bullets_to_spawn(use_compiled_data);
+
+	if (amount_bullets_per_instance == 0) {
 		UtilityFunctions::push_error("Error when trying to pool bullets. No transforms were provided in the spawn data. Ignoring the request");
 		return;
 	}
@@ -441,7 +953,15 @@ void BulletFactory2D::populate_bullets_pool(const Ref<MultiMeshBulletsData2D> &m
 		return;
 	}
 
-	const int amount_bullets_per_instance = multimesh_data->transforms.size();
+	is_factory_busy = true;
+
+	bool enable_processing_after_finish = is_factory_processing_bullets;
+	set_is_factory_processing_bullets(false);
+
+	bool debugger_was_enabled = get_is_debugger_enabled();
+	if (debugger_was_enabled) {
+		set_is_debugger_enabled(false);
+	}
 
 	switch (bullet_type) {
 		case BulletFactory2D::DIRECTIONAL_BULLETS:
@@ -451,7 +971,8 @@ void BulletFactory2D::populate_bullets_pool(const Ref<MultiMeshBulletsData2D> &m
 					directional_bullets_pool,
 					directional_bullets_container,
 					amount_instances,
-					amount_bullets_per_instance);
+					amount_bullets_per_instance,
+					use_compiled_data);
 			break;
 		case BulletFactory2D::BLOCK_BULLETS:
 			populate_bullets_pool_helper<BlockBullets2D>(
@@ -460,7 +981,8 @@ void BulletFactory2D::populate_bullets_pool(const Ref<MultiMeshBulletsData2D> &m
 					block_bullets_pool,
 					block_bullets_container,
 					amount_instances,
-					amount_bullets_per_instance);
+					amount_bullets_per_instance,
+					use_compiled_data);
 			break;
 		default:
 			UtilityFunctions::push_error("Unsupported type of bullet when calling populate_bullets_pool");
@@ -500,7 +1022,7 @@ void BulletFactory2D::free_bullets_pool(BulletType bullet_type, int amount_bulle
 					all_directional_bullets,
 					directional_bullets_set,
 					directional_bullets_pool,
-					amount_bullets_per_instance);
+					directional_bullets_pool.get_size_class(amount_bullets_per_instance));
 		} break;
 
 		case BulletFactory2D::BLOCK_BULLETS: {
@@ -508,7 +1030,7 @@ void BulletFactory2D::free_bullets_pool(BulletType bullet_type, int amount_bulle
 					all_block_bullets,
 					block_bullets_set,
 					block_bullets_pool,
-					amount_bullets_per_instance);
+					block_bullets_pool.get_size_class(amount_bullets_per_instance));
 
 		} break;
 
@@ -529,6 +1051,86 @@ void BulletFactory2D::free_bullets_pool(BulletType bullet_type, int amount_bulle
 	}
 }
 
+int BulletFactory2D::populate_bullets_pool_incremental(const Ref<MultiMeshBulletsData2D> &multimesh_data, int amount_instances, int budget_usec) {
+	if (multimesh_data.is_null()) {
+		UtilityFunctions::push_error("Error when trying to call populate_bullets_pool_incremental. The spawn data is null. Ignoring the request");
+		return -1;
+	}
+
+	if (amount_instances <= 0) {
+		UtilityFunctions::push_error("Error when trying to call populate_bullets_pool_incremental. You can't populate the bullets pool with amount_instances <= 0. Ignoring the request");
+		return -1;
+	}
+
+	if (multimesh_data->get_amount_bullets_to_spawn(multimesh_data->get_is_compiled()) == 0) {
+		UtilityFunctions::push_error("Error when trying to call populate_bullets_pool_incremental. No transforms were provided in the spawn data. Ignoring the request");
+		return -1;
+	}
+
+	BulletsPoolTask task;
+
+	if (multimesh_data->is_class("DirectionalBulletsData2D")) {
+		task.bullet_type = BulletFactory2D::DIRECTIONAL_BULLETS;
+	} else if (multimesh_data->is_class("BlockBulletsData2D")) {
+		task.bullet_type = BulletFactory2D::BLOCK_BULLETS;
+	} else {
+		UtilityFunctions::push_error("Error when trying to call populate_bullets_pool_incremental. Unsupported type of MultiMeshBulletsData2D. Ignoring the request");
+		return -1;
+	}
+
+	task.id = next_bullets_pool_task_id++;
+	task.is_populate = true;
+	task.spawn_data = multimesh_data;
+	task.amount_total = amount_instances;
+	task.budget_usec = Math::max(budget_usec, 0);
+
+	bullets_pool_tasks.emplace_back(task);
+
+	return task.id;
+}
+
+int BulletFactory2D::free_bullets_pool_incremental(BulletType bullet_type, int amount_bullets_per_instance, int budget_usec) {
+	BulletsPoolTask task;
+
+	// The pool is keyed by the capacity of the multimeshes, which is the size class of the amount of bullets
+	switch (bullet_type) {
+		case BulletFactory2D::DIRECTIONAL_BULLETS:
+			amount_bullets_per_instance = directional_bullets_pool.get_size_class(amount_bullets_per_instance);
+			task.amount_total = amount_bullets_per_instance > 0 ? directional_bullets_pool.get_amount_pooled(amount_bullets_per_instance) : directional_bullets_pool.get_total_amount_pooled();
+			break;
+		case BulletFactory2D::BLOCK_BULLETS:
+			amount_bullets_per_instance = block_bullets_pool.get_size_class(amount_bullets_per_instance);
+			task.amount_total = amount_bullets_per_instance > 0 ? block_bullets_pool.get_amount_pooled(amount_bullets_per_instance) : block_bullets_pool.get_total_amount_pooled();
+			break;
+		default:
+			UtilityFunctions::push_error("Error when trying to call free_bullets_pool_incremental. Unsupported type of bullet. Ignoring the request");
+			return -1;
+	}
+
+	task.id = next_bullets_pool_task_id++;
+	task.is_populate = false;
+	task.bullet_type = bullet_type;
+	task.amount_bullets_per_instance = amount_bullets_per_instance;
+	task.budget_usec = Math::max(budget_usec, 0);
+
+	bullets_pool_tasks.emplace_back(task);
+
+	return task.id;
+}
+
+void BulletFactory2D::cancel_bullets_pool_task(int task_id) {
+	for (auto it = bullets_pool_tasks.begin(); it != bullets_pool_tasks.end(); ++it) {
+		if (it->id == task_id) {
+			bullets_pool_tasks.erase(it);
+			return;
+		}
+	}
+}
+
+int BulletFactory2D::get_bullets_pool_tasks_amount() const {
+	return static_cast<int>(bullets_pool_tasks.size());
+}
+
 void BulletFactory2D::populate_attachments_pool(const Ref<PackedScene> attachment_scene, int attachment_id, int amount_instances) {
 	if (amount_instances <= 0 || attachment_scene.is_null()) {
 		UtilityFunctions::push_error("Invalid parameters for populate_attachments_pool.");
@@ -689,6 +1291,17 @@ void BulletFactory2D::set_is_debugger_enabled(bool new_is_enabled) {
 	block_bullets_debugger->set_is_debugger_enabled(new_is_enabled);
 }
 
+void BulletFactory2D::pause_debugger_until_next_frame() {
+	if (is_debugger_paused_this_frame || !get_is_debugger_enabled()) {
+		return;
+	}
+
+	is_debugger_paused_this_frame = true;
+
+	set_is_debugger_enabled(false);
+	call_deferred("set_is_debugger_enabled", true); // it will cause a crash if this is not called with call_deferred
+}
+
 // Additional debug methods
 int BulletFactory2D::debug_get_total_bullets_amount(BulletType bullet_type) {
 	switch (bullet_type) {
@@ -754,6 +1367,39 @@ Dictionary BulletFactory2D::debug_get_bullets_pool_info(BulletType bullet_type)
 	return dict;
 }
 
+int BulletFactory2D::debug_get_bullets_pool_wasted_slots(BulletType bullet_type) {
+	auto count_wasted_slots = [](const auto &bullets_vec) {
+		int wasted_slots = 0;
+		for (const auto *multi : bullets_vec) {
+			if (multi->is_active) {
+				wasted_slots += multi->get_amount_bullets_capacity() - multi->get_amount_bullets();
+			}
+		}
+		return wasted_slots;
+	};
+
+	switch (bullet_type) {
+		case BlastBullets2D::BulletFactory2D::DIRECTIONAL_BULLETS:
+			return count_wasted_slots(all_directional_bullets);
+			break;
+		case BlastBullets2D::BulletFactory2D::BLOCK_BULLETS:
+			return count_wasted_slots(all_block_bullets);
+			break;
+		default:
+			UtilityFunctions::push_error("Error when trying to get bullets pool wasted slots. BulletType you gave is not supported");
+			return -1;
+			break;
+	}
+}
+
+int BulletFactory2D::debug_get_shared_quad_meshes_amount() const {
+	return shared_resources_cache.get_quad_meshes_amount();
+}
+
+int BulletFactory2D::debug_get_shared_collision_shapes_amount() const {
+	return shared_resources_cache.get_rectangle_shapes_amount();
+}
+
 int BulletFactory2D::debug_get_total_attachments_amount() {
 	return bullet_attachments_container->get_child_count();
 }
@@ -950,9 +1596,71 @@ void BulletFactory2D::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_physics_interpolation"), "set_use_physics_interpolation_editor", "get_use_physics_interpolation");
 
+	ClassDB::bind_method(D_METHOD("get_use_multithreading"), &BulletFactory2D::get_use_multithreading);
+	ClassDB::bind_method(D_METHOD("set_use_multithreading", "enable"), &BulletFactory2D::set_use_multithreading);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_multithreading"), "set_use_multithreading", "get_use_multithreading");
+
+	ClassDB::bind_method(D_METHOD("get_use_collision_grid"), &BulletFactory2D::get_use_collision_grid);
+	ClassDB::bind_method(D_METHOD("set_use_collision_grid", "enable"), &BulletFactory2D::set_use_collision_grid);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_collision_grid"), "set_use_collision_grid", "get_use_collision_grid");
+
+	ClassDB::bind_method(D_METHOD("get_collision_grid_cell_size"), &BulletFactory2D::get_collision_grid_cell_size);
+	ClassDB::bind_method(D_METHOD("set_collision_grid_cell_size", "new_cell_size"), &BulletFactory2D::set_collision_grid_cell_size);
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "collision_grid_cell_size"), "set_collision_grid_cell_size", "get_collision_grid_cell_size");
+
+	ClassDB::bind_method(D_METHOD("collision_grid_add_target", "target", "size", "collision_layer", "is_body"), &BulletFactory2D::collision_grid_add_target, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("collision_grid_add_target_rid", "target_rid", "size", "collision_layer", "is_body"), &BulletFactory2D::collision_grid_add_target_rid, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("collision_grid_remove_target", "target"), &BulletFactory2D::collision_grid_remove_target);
+	ClassDB::bind_method(D_METHOD("collision_grid_remove_target_rid", "target_rid"), &BulletFactory2D::collision_grid_remove_target_rid);
+	ClassDB::bind_method(D_METHOD("collision_grid_clear_targets"), &BulletFactory2D::collision_grid_clear_targets);
+	ClassDB::bind_method(D_METHOD("collision_grid_get_targets_amount"), &BulletFactory2D::collision_grid_get_targets_amount);
+
+	ClassDB::bind_method(D_METHOD("get_use_bullets_pool_size_classes"), &BulletFactory2D::get_use_bullets_pool_size_classes);
+	ClassDB::bind_method(D_METHOD("set_use_bullets_pool_size_classes", "enable"), &BulletFactory2D::set_use_bullets_pool_size_classes);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_bullets_pool_size_classes"), "set_use_bullets_pool_size_classes", "get_use_bullets_pool_size_classes");
+
+	ClassDB::bind_method(D_METHOD("get_bullets_pool_size_classes"), &BulletFactory2D::get_bullets_pool_size_classes);
+	ClassDB::bind_method(D_METHOD("set_bullets_pool_size_classes", "new_size_classes"), &BulletFactory2D::set_bullets_pool_size_classes);
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "bullets_pool_size_classes"), "set_bullets_pool_size_classes", "get_bullets_pool_size_classes");
+
+	ClassDB::bind_method(D_METHOD("get_use_bullets_pool_auto_tuning"), &BulletFactory2D::get_use_bullets_pool_auto_tuning);
+	ClassDB::bind_method(D_METHOD("set_use_bullets_pool_auto_tuning", "enable"), &BulletFactory2D::set_use_bullets_pool_auto_tuning);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_bullets_pool_auto_tuning"), "set_use_bullets_pool_auto_tuning", "get_use_bullets_pool_auto_tuning");
+
+	ClassDB::bind_method(D_METHOD("get_bullets_pool_auto_tuning_window"), &BulletFactory2D::get_bullets_pool_auto_tuning_window);
+	ClassDB::bind_method(D_METHOD("set_bullets_pool_auto_tuning_window", "value"), &BulletFactory2D::set_bullets_pool_auto_tuning_window);
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bullets_pool_auto_tuning_window"), "set_bullets_pool_auto_tuning_window", "get_bullets_pool_auto_tuning_window");
+
+	ClassDB::bind_method(D_METHOD("get_bullets_pool_auto_tuning_headroom"), &BulletFactory2D::get_bullets_pool_auto_tuning_headroom);
+	ClassDB::bind_method(D_METHOD("set_bullets_pool_auto_tuning_headroom", "value"), &BulletFactory2D::set_bullets_pool_auto_tuning_headroom);
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bullets_pool_auto_tuning_headroom"), "set_bullets_pool_auto_tuning_headroom", "get_bullets_pool_auto_tuning_headroom");
+
+	ClassDB::bind_method(D_METHOD("get_bullets_pool_auto_tuning_idle_time"), &BulletFactory2D::get_bullets_pool_auto_tuning_idle_time);
+	ClassDB::bind_method(D_METHOD("set_bullets_pool_auto_tuning_idle_time", "value"), &BulletFactory2D::set_bullets_pool_auto_tuning_idle_time);
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bullets_pool_auto_tuning_idle_time"), "set_bullets_pool_auto_tuning_idle_time", "get_bullets_pool_auto_tuning_idle_time");
+
+	ClassDB::bind_method(D_METHOD("get_bullets_pool_auto_tuning_budget_usec"), &BulletFactory2D::get_bullets_pool_auto_tuning_budget_usec);
+	ClassDB::bind_method(D_METHOD("set_bullets_pool_auto_tuning_budget_usec", "value"), &BulletFactory2D::set_bullets_pool_auto_tuning_budget_usec);
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "bullets_pool_auto_tuning_budget_usec"), "set_bullets_pool_auto_tuning_budget_usec", "get_bullets_pool_auto_tuning_budget_usec");
+
+	ClassDB::bind_method(D_METHOD("get_use_collision_batching"), &BulletFactory2D::get_use_collision_batching);
+	ClassDB::bind_method(D_METHOD("set_use_collision_batching", "enable"), &BulletFactory2D::set_use_collision_batching);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_collision_batching"), "set_use_collision_batching", "get_use_collision_batching");
+
+	ClassDB::bind_method(D_METHOD("get_collisions_batch_target_instance_ids"), &BulletFactory2D::get_collisions_batch_target_instance_ids);
+	ClassDB::bind_method(D_METHOD("get_collisions_batch_multimesh_instance_ids"), &BulletFactory2D::get_collisions_batch_multimesh_instance_ids);
+	ClassDB::bind_method(D_METHOD("get_collisions_batch_bullet_indexes"), &BulletFactory2D::get_collisions_batch_bullet_indexes);
+	ClassDB::bind_method(D_METHOD("get_collisions_batch_bullet_positions"), &BulletFactory2D::get_collisions_batch_bullet_positions);
+	ClassDB::bind_method(D_METHOD("get_collisions_batch_amount"), &BulletFactory2D::get_collisions_batch_amount);
+
 	ClassDB::bind_method(D_METHOD("spawn_block_bullets", "spawn_data"), &BulletFactory2D::spawn_block_bullets);
 	ClassDB::bind_method(D_METHOD("spawn_directional_bullets", "spawn_data", "inherited_velocity_offset"), &BulletFactory2D::spawn_directional_bullets, DEFVAL(Vector2(0, 0)));
 	ClassDB::bind_method(D_METHOD("spawn_controllable_directional_bullets", "spawn_data", "inherited_velocity_offset"), &BulletFactory2D::spawn_controllable_directional_bullets, DEFVAL(Vector2(0, 0)));
+	ClassDB::bind_method(D_METHOD("spawn_directional_bullets_emitter", "spawn_data", "inherited_velocity_offset"), &BulletFactory2D::spawn_directional_bullets_emitter, DEFVAL(Vector2(0, 0)));
+	ClassDB::bind_method(D_METHOD("free_bullets_emitter", "emitter"), &BulletFactory2D::free_bullets_emitter);
+	ClassDB::bind_method(D_METHOD("spawn_directional_bullets_from_template", "spawn_template", "origin", "rotation_radians", "inherited_velocity_offset"), &BulletFactory2D::spawn_directional_bullets_from_template, DEFVAL(0.0), DEFVAL(Vector2(0, 0)));
+	ClassDB::bind_method(D_METHOD("spawn_block_bullets_from_template", "spawn_template", "origin", "rotation_radians"), &BulletFactory2D::spawn_block_bullets_from_template, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("spawn_controllable_directional_bullets_from_template", "spawn_template", "origin", "rotation_radians", "inherited_velocity_offset"), &BulletFactory2D::spawn_controllable_directional_bullets_from_template, DEFVAL(0.0), DEFVAL(Vector2(0, 0)));
 
 	ClassDB::bind_method(D_METHOD("reset", "amount_bullets"), &BulletFactory2D::reset, DEFVAL(0));
 
@@ -966,6 +1674,10 @@ void BulletFactory2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("populate_bullets_pool", "multimesh_data", "amount_instances"), &BulletFactory2D::populate_bullets_pool);
 	ClassDB::bind_method(D_METHOD("free_bullets_pool", "bullet_type", "amount_bullets_per_instance"), &BulletFactory2D::free_bullets_pool, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("populate_bullets_pool_incremental", "multimesh_data", "amount_instances", "budget_usec"), &BulletFactory2D::populate_bullets_pool_incremental, DEFVAL(1000));
+	ClassDB::bind_method(D_METHOD("free_bullets_pool_incremental", "bullet_type", "amount_bullets_per_instance", "budget_usec"), &BulletFactory2D::free_bullets_pool_incremental, DEFVAL(0), DEFVAL(1000));
+	ClassDB::bind_method(D_METHOD("cancel_bullets_pool_task", "task_id"), &BulletFactory2D::cancel_bullets_pool_task);
+	ClassDB::bind_method(D_METHOD("get_bullets_pool_tasks_amount"), &BulletFactory2D::get_bullets_pool_tasks_amount);
 
 	ClassDB::bind_method(D_METHOD("populate_attachments_pool", "attachment_scene", "attachment_id", "amount_attachments"), &BulletFactory2D::populate_attachments_pool);
 	ClassDB::bind_method(D_METHOD("free_attachments_pool", "attachment_id"), &BulletFactory2D::free_attachments_pool, DEFVAL(-1));
@@ -983,6 +1695,10 @@ void BulletFactory2D::_bind_methods() {
 			D_METHOD("debug_get_bullets_pool_info", "bullet_type"),
 			&BulletFactory2D::debug_get_bullets_pool_info);
 
+	ClassDB::bind_method(D_METHOD("debug_get_bullets_pool_wasted_slots", "bullet_type"), &BulletFactory2D::debug_get_bullets_pool_wasted_slots);
+	ClassDB::bind_method(D_METHOD("debug_get_shared_quad_meshes_amount"), &BulletFactory2D::debug_get_shared_quad_meshes_amount);
+	ClassDB::bind_method(D_METHOD("debug_get_shared_collision_shapes_amount"), &BulletFactory2D::debug_get_shared_collision_shapes_amount);
+
 	ClassDB::bind_method(D_METHOD("debug_get_total_attachments_amount"), &BulletFactory2D::debug_get_total_attachments_amount);
 	ClassDB::bind_method(D_METHOD("debug_get_active_attachments_amount"), &BulletFactory2D::debug_get_active_attachments_amount);
 	ClassDB::bind_method(D_METHOD("debug_get_attachments_pool_amount"), &BulletFactory2D::debug_get_attachments_pool_amount);
@@ -1033,6 +1749,20 @@ void BulletFactory2D::_bind_methods() {
 
 	ADD_SIGNAL(MethodInfo("reset_finished"));
 
+	ADD_SIGNAL(MethodInfo("bullets_pool_task_progress",
+			PropertyInfo(Variant::INT, "task_id"),
+			PropertyInfo(Variant::INT, "amount_done"),
+			PropertyInfo(Variant::INT, "amount_total")));
+
+	ADD_SIGNAL(MethodInfo("bullets_pool_task_finished",
+			PropertyInfo(Variant::INT, "task_id")));
+
+	ADD_SIGNAL(MethodInfo("collisions_batch",
+			PropertyInfo(Variant::PACKED_INT64_ARRAY, "target_instance_ids"),
+			PropertyInfo(Variant::PACKED_INT64_ARRAY, "multimesh_instance_ids"),
+			PropertyInfo(Variant::PACKED_INT32_ARRAY, "bullet_indexes"),
+			PropertyInfo(Variant::PACKED_VECTOR2_ARRAY, "bullet_positions")));
+
 	// Need this in order to expose the enum constants to Godot Engine
 	// For Bullet Type that is supported
 	BIND_ENUM_CONSTANT(DIRECTIONAL_BULLETS);
@@ -1,13 +1,23 @@
 #pragma once
 
 #include <algorithm>
+#include <deque>
+#include <map>
 
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/node2d.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
 #include <utility>
+#include <vector>
 
 #include "../shared/bullet_attachment_object_pool2d.hpp"
+#include "../shared/bullet_collision_grid2d.hpp"
+#include "../shared/bullet_shared_resources_cache2d.hpp"
+#include "../shared/bullet_timer_scheduler2d.hpp"
+#include "../shared/bullets_container2d.hpp"
 #include "../shared/multimesh_object_pool2d.hpp"
 #include "godot_cpp/variant/vector2.hpp"
 #include "shared/dynamic_sparse_set.hpp"
@@ -67,6 +77,21 @@ public:
 	// Spawns DirectionalBullets2D when given a resource containing all needed data. These bullets should be controlled by the user
 	DirectionalBullets2D *spawn_controllable_directional_bullets(const Ref<DirectionalBulletsData2D> &spawn_data, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0));
 
+	// Spawns DirectionalBullets2D from compiled spawn data (a template). The compiled transforms are placed relative to the origin, rotated by the rotation
+	void spawn_directional_bullets_from_template(const Ref<DirectionalBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians = 0.0, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0));
+
+	// Spawns BlockBullets2D from compiled spawn data (a template). The compiled transforms are placed relative to the origin, rotated by the rotation
+	void spawn_block_bullets_from_template(const Ref<BlockBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians = 0.0);
+
+	// Spawns DirectionalBullets2D from compiled spawn data (a template). These bullets should be controlled by the user
+	DirectionalBullets2D *spawn_controllable_directional_bullets_from_template(const Ref<DirectionalBulletsData2D> &spawn_template, const Vector2 &origin, real_t rotation_radians = 0.0, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0));
+
+	// Spawns an emitter - a DirectionalBullets2D whose capacity is the amount of bullets in the spawn data. All of its bullets start retired and get emitted one by one with emit_bullet, so a whole stream of bullets uses a single node, area and draw call. The emitter never goes back to the object pool
+	DirectionalBullets2D *spawn_directional_bullets_emitter(const Ref<DirectionalBulletsData2D> &spawn_data, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0));
+
+	// Frees an emitter that is no longer needed
+	void free_bullets_emitter(DirectionalBullets2D *emitter);
+
 	// Resets the factory - frees everything (object pools, spawned bullets, spawned attachments - all get deleted from memory)
 	void reset(int amount_bullets = 0);
 
@@ -101,6 +126,16 @@ public:
 
 	//
 
+	// SHARED RESOURCES
+
+	// The QuadMeshes and collision shapes that are shared by all bullet multimeshes
+	BulletSharedResourcesCache2D shared_resources_cache;
+
+	// Runs the time based functions attached to all bullet multimeshes
+	BulletTimerScheduler2D timer_scheduler;
+
+	//
+
 	// PHYSICS INTERPOLATION
 
 	// Toggle physics interpolation on/off
@@ -108,6 +143,117 @@ public:
 
 	//
 
+	// MULTITHREADING
+
+	// Whether the bullet multimeshes are moved in parallel by WorkerThreadPool tasks. Everything that touches nodes, servers or signals is still applied on the main thread afterwards
+	bool use_multithreading = false;
+	bool get_use_multithreading() const;
+	void set_use_multithreading(bool value);
+
+	//
+
+	// COLLISION GRID
+
+	// Whether newly spawned (or enabled) bullet multimeshes use the built-in collision grid instead of the physics server. Their areas are removed from the physics space and the collisions are only detected against the targets registered with the collision_grid_add_target methods
+	bool use_collision_grid = false;
+	bool get_use_collision_grid() const;
+	void set_use_collision_grid(bool value);
+
+	real_t get_collision_grid_cell_size() const;
+	void set_collision_grid_cell_size(real_t new_cell_size);
+
+	void collision_grid_add_target(Node2D *target, const Vector2 &size, int collision_layer, bool is_body = false);
+	void collision_grid_add_target_rid(const RID &target_rid, const Vector2 &size, int collision_layer, bool is_body = false);
+	void collision_grid_remove_target(Node2D *target);
+	void collision_grid_remove_target_rid(const RID &target_rid);
+	void collision_grid_clear_targets();
+	int collision_grid_get_targets_amount() const;
+
+	//
+
+	// OBJECT POOL SIZE CLASSES
+
+	// Whether bullet multimeshes are allocated and pooled by size class instead of by their exact amount of bullets
+	bool use_bullets_pool_size_classes = false;
+	bool get_use_bullets_pool_size_classes() const;
+	void set_use_bullets_pool_size_classes(bool value);
+
+	// The allowed capacities. Empty means power of two size classes
+	PackedInt32Array bullets_pool_size_classes;
+	PackedInt32Array get_bullets_pool_size_classes() const;
+	void set_bullets_pool_size_classes(const PackedInt32Array &new_size_classes);
+
+	//
+
+	// OBJECT POOL TIME SLICING
+
+	// Same as populate_bullets_pool, but the multimeshes are created over multiple frames, spending at most budget_usec microseconds per frame (at least one multimesh is always created per frame). Every created multimesh goes in the pool right away, so spawning keeps working while the task is still running. Returns the id of the task or -1 if the request was invalid
+	int populate_bullets_pool_incremental(const Ref<MultiMeshBulletsData2D> &multimesh_data, int amount_instances, int budget_usec = 1000);
+
+	// Same as free_bullets_pool, but the pooled multimeshes are freed over multiple frames, spending at most budget_usec microseconds per frame. Returns the id of the task
+	int free_bullets_pool_incremental(BulletType bullet_type, int amount_bullets_per_instance = 0, int budget_usec = 1000);
+
+	// Stops a task that hasn't finished yet. Whatever the task already did stays done
+	void cancel_bullets_pool_task(int task_id);
+
+	// The amount of tasks that haven't finished yet
+	int get_bullets_pool_tasks_amount() const;
+
+	//
+
+	// OBJECT POOL AUTO TUNING
+
+	// Whether the bullet object pools grow and shrink by themselves based on how many multimeshes of each bullet type and size class were active at the same time recently
+	bool use_bullets_pool_auto_tuning = false;
+	bool get_use_bullets_pool_auto_tuning() const;
+	void set_use_bullets_pool_auto_tuning(bool value);
+
+	// The length (in seconds) of the window in which the peak amount of active multimeshes is tracked
+	double bullets_pool_auto_tuning_window = 10.0;
+	double get_bullets_pool_auto_tuning_window() const;
+	void set_bullets_pool_auto_tuning_window(double value);
+
+	// How many multimeshes to keep ready on top of the peak, relative to the peak (0.25 means 25% more)
+	double bullets_pool_auto_tuning_headroom = 0.25;
+	double get_bullets_pool_auto_tuning_headroom() const;
+	void set_bullets_pool_auto_tuning_headroom(double value);
+
+	// How long (in seconds) a pooled multimesh that is not needed has to stay unused before it gets freed
+	double bullets_pool_auto_tuning_idle_time = 30.0;
+	double get_bullets_pool_auto_tuning_idle_time() const;
+	void set_bullets_pool_auto_tuning_idle_time(double value);
+
+	// How much time (in microseconds) the auto tuning can spend growing/trimming the pools every frame
+	int bullets_pool_auto_tuning_budget_usec = 500;
+	int get_bullets_pool_auto_tuning_budget_usec() const;
+	void set_bullets_pool_auto_tuning_budget_usec(int value);
+
+	//
+
+	// COLLISION BATCHING
+
+	// Whether all collisions of a physics frame are delivered at once through the collisions_batch signal (and the get_collisions_batch_* methods) instead of emitting area_entered/body_entered for every single hit
+	bool use_collision_batching = false;
+	bool get_use_collision_batching() const;
+	void set_use_collision_batching(bool value);
+
+	// Records a single collision. Called by the bullet multimeshes while they handle their collisions
+	_ALWAYS_INLINE_ void queue_batched_collision(int64_t target_instance_id, int64_t multimesh_instance_id, int bullet_index, const Vector2 &bullet_position) {
+		batched_target_instance_ids.push_back(target_instance_id);
+		batched_multimesh_instance_ids.push_back(multimesh_instance_id);
+		batched_bullet_indexes.push_back(bullet_index);
+		batched_bullet_positions.push_back(bullet_position);
+	}
+
+	// The collisions of the last physics frame (pull API, so the signal doesn't have to be connected)
+	PackedInt64Array get_collisions_batch_target_instance_ids() const;
+	PackedInt64Array get_collisions_batch_multimesh_instance_ids() const;
+	PackedInt32Array get_collisions_batch_bullet_indexes() const;
+	PackedVector2Array get_collisions_batch_bullet_positions() const;
+	int get_collisions_batch_amount() const;
+
+	//
+
 	// OTHER
 
 	// The physics space where the bullet multimeshes are interacting with the world
@@ -127,6 +273,13 @@ public:
 
 	Dictionary debug_get_bullets_pool_info(BulletType bullet_type);
 
+	// The amount of allocated bullet instances that active multimeshes don't use (because they were re-used from a bigger size class)
+	int debug_get_bullets_pool_wasted_slots(BulletType bullet_type);
+
+	// The amount of QuadMeshes/collision shapes that are currently shared by the bullet multimeshes
+	int debug_get_shared_quad_meshes_amount() const;
+	int debug_get_shared_collision_shapes_amount() const;
+
 	int debug_get_total_attachments_amount();
 	int debug_get_active_attachments_amount();
 	int debug_get_attachments_pool_amount();
@@ -144,6 +297,9 @@ protected:
 	// Responsible for exposing C++ methods/properties to Godot Engine
 	static void _bind_methods();
 
+	// The bullet multimeshes are not nodes, so the factory frees them itself when it gets deleted
+	void _notification(int p_what);
+
 private:
 	// Whether the factory was spawned correctly and the ready function finished. Used in order to avoid bugs related to editor executing getters/setters that should only be executed during runtime / gameplay. If a getter/setter is executed when in editor then those values get cached in different variables and finally get applied in _ready()
 	bool is_ready = false;
@@ -166,8 +322,8 @@ private:
 	// Keeps track of all directional bullets that were spawned
 	std::vector<DirectionalBullets2D *> all_directional_bullets;
 
-	// Contains all DirectionalBullets2D in the scene tree
-	Node *directional_bullets_container = nullptr;
+	// Draws all DirectionalBullets2D (they are not nodes)
+	BulletsContainer2D directional_bullets_container;
 
 	// Holds all disabled DirectionalBullets2D
 	MultiMeshObjectPool directional_bullets_pool;
@@ -178,8 +334,8 @@ private:
 
 	std::vector<BlockBullets2D *> all_block_bullets;
 
-	// Contains all BlockBullets2D in the scene tree
-	Node *block_bullets_container = nullptr;
+	// Draws all BlockBullets2D (they are not nodes)
+	BulletsContainer2D block_bullets_container;
 
 	// Holds all disabled BlockBullets2D
 	MultiMeshObjectPool block_bullets_pool;
@@ -232,9 +388,135 @@ private:
 
 	//
 
+	// MULTITHREADING RELATED
+
+	// A single WorkerThreadPool task - moves one range of the active bullets of a single multimesh
+	struct WorkerThreadTask {
+		MultiMeshBullets2D *multi = nullptr;
+		int range_index = 0;
+
+		WorkerThreadTask() = default;
+		WorkerThreadTask(MultiMeshBullets2D *new_multi, int new_range_index) :
+				multi(new_multi),
+				range_index(new_range_index) {}
+	};
+
+	// The maximum amount of bullets a single worker thread task moves. A multimesh with more active bullets is split into multiple tasks, so that even a single huge volley is moved by all worker threads. Smaller tasks balance better across the threads, but each task has some overhead
+	static constexpr int MAX_BULLETS_PER_WORKER_THREAD_TASK = 2048;
+
+	// The multimeshes that are moved by worker threads during the current physics frame
+	std::vector<MultiMeshBullets2D *> worker_thread_multis;
+
+	// The tasks of the current physics frame
+	std::vector<WorkerThreadTask> worker_thread_tasks;
+
+	//
+
+	// OBJECT POOL SIZE CLASSES RELATED
+
+	// Passes the size class settings to all bullet object pools
+	void update_bullets_pool_size_classes();
+
+	//
+
+	// OBJECT POOL TIME SLICING RELATED
+
+	// A populate/free request that is being worked on over multiple frames
+	struct BulletsPoolTask {
+		int id = -1;
+
+		bool is_populate = true;
+		BulletType bullet_type = DIRECTIONAL_BULLETS;
+
+		// Used only when populating
+		Ref<MultiMeshBulletsData2D> spawn_data;
+
+		// Used only when freeing - the bullets capacity to free (0 or less means all)
+		int amount_bullets_per_instance = 0;
+
+		// The amount of multimeshes that were created/freed so far and the amount that should be created/freed in total
+		int amount_done = 0;
+		int amount_total = 0;
+
+		int budget_usec = 1000;
+	};
+
+	// Worked on in order - a task only starts after the previous one has finished
+	std::deque<BulletsPoolTask> bullets_pool_tasks;
+	int next_bullets_pool_task_id = 0;
+
+	// Works on the queued tasks within the time budget of the first one. Called every frame
+	void handle_bullets_pool_tasks();
+
+	// Creates/frees a single multimesh. Returns false if there is nothing left to do
+	bool step_bullets_pool_task(BulletsPoolTask &task);
+
+	//
+
+	// OBJECT POOL AUTO TUNING RELATED
+
+	// How a single size class (bullets capacity) of a bullet type has been used recently
+	struct BulletsPoolUsage {
+		// The amount of multimeshes that are active right now
+		int amount_active = 0;
+
+		// The peak amount of active multimeshes in the current and in the previous window. The peak over the last window is the bigger one of the two
+		int window_peak = 0;
+		int previous_window_peak = 0;
+
+		// The spawn data that was last used for this size class. Needed in order to create new multimeshes for the pool
+		Ref<MultiMeshBulletsData2D> spawn_data;
+
+		// Whether the spawn data was spawned from its compiled arrays (as a template)
+		bool use_compiled_data = false;
+	};
+
+	// The key is the bullets capacity
+	std::map<int, BulletsPoolUsage> directional_bullets_pool_usage;
+	std::map<int, BulletsPoolUsage> block_bullets_pool_usage;
+
+	// How much time has passed in the current auto tuning window
+	double bullets_pool_auto_tuning_window_time = 0.0;
+
+	// The bullet types take turns in being tuned first, so that one of them can't use up the whole time budget every frame
+	bool auto_tune_block_bullets_first = false;
+
+	// Grows/trims all bullet object pools within the time budget. Called every frame
+	void handle_bullets_pool_auto_tuning(double delta);
+
+	//
+
+	// COLLISION BATCHING RELATED
+
+	// The collisions recorded during the current physics frame. They keep their capacity between frames so recording a collision doesn't allocate
+	std::vector<int64_t> batched_target_instance_ids;
+	std::vector<int64_t> batched_multimesh_instance_ids;
+	std::vector<int32_t> batched_bullet_indexes;
+	std::vector<Vector2> batched_bullet_positions;
+
+	// The collisions of the last physics frame that had any
+	PackedInt64Array collisions_batch_target_instance_ids;
+	PackedInt64Array collisions_batch_multimesh_instance_ids;
+	PackedInt32Array collisions_batch_bullet_indexes;
+	PackedVector2Array collisions_batch_bullet_positions;
+
+	// Copies the recorded collisions into the packed arrays and emits the collisions_batch signal. Called once at the end of every physics frame
+	void flush_collisions_batch();
+
+	//
+
+	// COLLISION GRID RELATED
+
+	BulletCollisionGrid2D collision_grid;
+
+	// Inserts the bullets of all active multimeshes that use the collision grid, detects the collisions and lets the multimeshes handle them
+	void handle_collision_grid();
+
+	//
+
 	// FACTORY CHILDREN
 
-	// Adds containers as children of the factory, meant to hold bullets
+	// Creates the containers that hold the bullets. They are not nodes, their canvas items are drawn directly on the canvas of the factory
 	void add_bullet_containers();
 
 	// Adds a single container as a child of the factory, where bullet attachments are always spawned
@@ -243,13 +525,19 @@ private:
 	// Adds the debuggers as children of the factory
 	void add_debuggers();
 
+	// Whether the debugger was already turned off during the current frame
+	bool is_debugger_paused_this_frame = false;
+
+	// The debugger keeps pointers to the multimeshes, so it has to be regenerated after multimeshes get created/freed outside of the usual spawn. Turns it off until the next frame (only once per frame)
+	void pause_debugger_until_next_frame();
+
 	//
 
 	// TEMPLATES
 
 	// Populates a bullets pool with disabled bullet instances. It's mandatory that the TBullet type inherits from MultiMeshBullets2D
 	template <typename TBullet>
-	void populate_bullets_pool_helper(const Ref<MultiMeshBulletsData2D> &spawn_data, std::vector<TBullet *> &bullets_vec, MultiMeshObjectPool &bullets_object_pool, Node *bullets_container, int amount_instances, int amount_bullets_per_instance, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0)) {
+	void populate_bullets_pool_helper(const Ref<MultiMeshBulletsData2D> &spawn_data, std::vector<TBullet *> &bullets_vec, MultiMeshObjectPool &bullets_object_pool, BulletsContainer2D &bullets_container, int amount_instances, int amount_bullets_per_instance, bool use_compiled_data, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0)) {
 		bullets_vec.reserve(bullets_vec.size() + amount_instances);
 		for (int i = 0; i < amount_instances; ++i) {
 			TBullet *bullets = memnew(TBullet);
@@ -257,7 +545,7 @@ private:
 			// Generate new id according to how many ids there are in the sparse set
 			int sparse_set_id = bullets_vec.size();
 
-			bullets->spawn(*spawn_data.ptr(), &bullets_object_pool, this, bullets_container, new_inherited_velocity_offset, sparse_set_id, true);
+			bullets->spawn(*spawn_data.ptr(), &bullets_object_pool, this, bullets_container, new_inherited_velocity_offset, sparse_set_id, true, bullets_object_pool.get_size_class(amount_bullets_per_instance), Transform2D(), use_compiled_data);
 			bullets_vec.emplace_back(bullets);
 		}
 	}
@@ -273,7 +561,7 @@ private:
 	void free_bullets_pool_helper(std::vector<TBullet *> &bullets_vec, DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, int amount_bullets_per_instance) {
 		// The criteria for what we are removing from the vector
 		auto removal_predicate = [amount_bullets_per_instance](const TBullet *multi) {
-			return multi != nullptr && !multi->is_active && (amount_bullets_per_instance <= 0 || multi->get_amount_bullets() == amount_bullets_per_instance);
+			return multi != nullptr && !multi->is_active && (amount_bullets_per_instance <= 0 || multi->get_amount_bullets_capacity() == amount_bullets_per_instance);
 			// We look only for disabled bullets (those that are in the pool)
 			// If amount_bullets_per_instance is negative, we remove ALL disabled bullets
 			// Otherwise we only remove disabled bullets that have a specific amount of bullets
@@ -304,6 +592,21 @@ private:
 		}
 	}
 
+	// Frees the pooled multimeshes whose capacity is no longer a size class, since pop() would never hand them out again
+	template <typename TBullet>
+	void free_unreachable_pooled_bullets_helper(std::vector<TBullet *> &bullets_vec, DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, std::map<int, BulletsPoolUsage> &pool_usage) {
+		for (const auto &[amount_bullets_capacity, amount_pooled] : bullets_pool.get_pool_info()) {
+			if (bullets_pool.get_size_class(amount_bullets_capacity) == amount_bullets_capacity) {
+				continue;
+			}
+
+			pause_debugger_until_next_frame();
+
+			free_bullets_pool_helper<TBullet>(bullets_vec, sparse_set, bullets_pool, amount_bullets_capacity);
+			pool_usage.erase(amount_bullets_capacity);
+		}
+	}
+
 	// Frees all multimeshes of a TBullet type and clears dangling pointers. If amount_bullets is 0 it clears ALL multimeshes, otherwise clears all multimeshes but only those with specific N amount bullets
 	template <typename TBullet>
 	void free_all_bullets_helper(std::vector<TBullet *> &bullets_vec, DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, int amount_bullets = 0) {
@@ -331,7 +634,7 @@ private:
 					continue;
 				}
 
-				if (bullet_multi->get_amount_bullets() == amount_bullets) {
+				if (bullet_multi->get_amount_bullets_capacity() == amount_bullets) {
 					// If it's active, it's NOT in the pool, so we must delete it here.
 					if (bullet_multi->is_active) {
 						bullet_multi->force_delete();
@@ -394,7 +697,7 @@ private:
 					continue;
 				}
 
-				if (bullet_multi->is_active && bullet_multi->get_amount_bullets() == amount_bullets) {
+				if (bullet_multi->is_active && bullet_multi->get_amount_bullets_capacity() == amount_bullets) {
 					bullet_multi->force_delete();
 				} else {
 					new_bullets_vec.push_back(bullet_multi);
@@ -451,7 +754,7 @@ private:
 					continue;
 				}
 
-				if (bullet_multi->get_amount_bullets() == amount_bullets && !bullet_multi->is_active) {
+				if (bullet_multi->get_amount_bullets_capacity() == amount_bullets && !bullet_multi->is_active) {
 					// free_specific_bullets will handle freeing these bullets
 				} else {
 					int new_id = static_cast<int>(surviving_bullets.size());
@@ -499,15 +802,26 @@ private:
 		sparse_set.disable_data(last_idx);
 	}
 
-	// Spawns bullets by either creating a brand new TBullet or retrieving one from the object pool
+	// Validates a template before spawning bullets from it. Returns false if the template can't be used
+	bool validate_spawn_template(const Ref<MultiMeshBulletsData2D> &spawn_template, const String &bullets_class_name);
+
+	// Spawns bullets by either creating a brand new TBullet or retrieving one from the object pool. The compiled arrays of the spawn data are used only when spawning from a template (use_compiled_data)
 	template <typename TBullet, typename TBulletSpawnData>
-	TBullet *spawn_bullets_helper(std::vector<TBullet *> &bullets_vec, DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, Node *bullets_container, const Ref<TBulletSpawnData> &spawn_data, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0)) {
-		int key = spawn_data->transforms.size();
+	TBullet *spawn_bullets_helper(std::vector<TBullet *> &bullets_vec, DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, std::map<int, BulletsPoolUsage> &pool_usage, BulletsContainer2D &bullets_container, const Ref<TBulletSpawnData> &spawn_data, const Vector2 &new_inherited_velocity_offset = Vector2(0, 0), const Transform2D &spawn_origin = Transform2D(), bool use_compiled_data = false) {
+		// The pool is keyed by capacity, so look for a multimesh of the size class that fits the amount of bullets
+		const int amount_bullets_capacity = bullets_pool.get_size_class(spawn_data->get_amount_bullets_to_spawn(use_compiled_data));
+
+		// Remember how this size class gets spawned, so the auto tuning can create more of the same multimeshes ahead of time
+		if (use_bullets_pool_auto_tuning) {
+			BulletsPoolUsage &usage = pool_usage[amount_bullets_capacity];
+			usage.spawn_data = spawn_data;
+			usage.use_compiled_data = use_compiled_data;
+		}
 
 		// Try to get a TBullet from the pool first
-		TBullet *bullets = static_cast<TBullet *>(bullets_pool.pop(key));
+		TBullet *bullets = static_cast<TBullet *>(bullets_pool.pop(amount_bullets_capacity));
 		if (bullets != nullptr) {
-			bullets->enable_multimesh(*spawn_data.ptr(), new_inherited_velocity_offset);
+			bullets->enable_multimesh(*spawn_data.ptr(), new_inherited_velocity_offset, spawn_origin, use_compiled_data);
 			sparse_set.activate_data(bullets->sparse_set_id);
 			return bullets;
 		}
@@ -517,7 +831,7 @@ private:
 
 		// If there was no TBullet in the pool, create a brand new one and spawn it
 		bullets = memnew(TBullet);
-		bullets->spawn(*spawn_data.ptr(), &bullets_pool, this, bullets_container, new_inherited_velocity_offset, sparse_set_id, false);
+		bullets->spawn(*spawn_data.ptr(), &bullets_pool, this, bullets_container, new_inherited_velocity_offset, sparse_set_id, false, amount_bullets_capacity, spawn_origin, use_compiled_data);
 		bullets_vec.emplace_back(bullets);
 
 		sparse_set.activate_data(sparse_set_id);
@@ -530,6 +844,11 @@ private:
 	void handle_bullet_behavior(const std::vector<TBullet *> &bullets_vec, const DynamicSparseSet &bullets_set, double delta) {
 		const auto &all_active_multis = bullets_set.get_active_indexes();
 
+		if (use_multithreading) {
+			handle_bullet_behavior_multithreaded<TBullet>(bullets_vec, all_active_multis, delta);
+			return;
+		}
+
 		for (auto index : all_active_multis) {
 			auto &multi = bullets_vec[index];
 
@@ -539,14 +858,172 @@ private:
 		}
 	}
 
-	// Handles rendering with physics interpolation
+	// Handles movement and other behaviors of the bullets by splitting the active bullets of every multimesh into ranges and moving each range in a separate WorkerThreadPool task. Everything that touches nodes (like refreshing the homing targets) is done on the main thread before the tasks start. The worker threads only do the math, the results get applied to the servers and nodes on the main thread after all tasks have finished
+	template <typename TBullet>
+	void handle_bullet_behavior_multithreaded(const std::vector<TBullet *> &bullets_vec, const std::vector<int> &all_active_multis, double delta) {
+		// Copy the multimeshes first, since handling collisions might disable some of them and change the sparse set while we are still iterating
+		worker_thread_multis.clear();
+		worker_thread_tasks.clear();
+
+		for (auto index : all_active_multis) {
+			TBullet *multi = bullets_vec[index];
+
+			const int amount_ranges = multi->prepare_worker_thread_simulation(delta, MAX_BULLETS_PER_WORKER_THREAD_TASK);
+			worker_thread_multis.emplace_back(multi);
+
+			for (int range_index = 0; range_index < amount_ranges; ++range_index) {
+				worker_thread_tasks.emplace_back(multi, range_index);
+			}
+		}
+
+		// A single task is not worth waking up the worker threads for
+		if (worker_thread_tasks.size() == 1) {
+			move_bullets_worker_thread_task<TBullet>(0);
+		} else if (worker_thread_tasks.size() > 1) {
+			WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
+			int64_t group_task_id = thread_pool->add_group_task(callable_mp(this, &BulletFactory2D::move_bullets_worker_thread_task<TBullet>), static_cast<int32_t>(worker_thread_tasks.size()), -1, true, "BlastBullets2D move bullets");
+			thread_pool->wait_for_group_task_completion(group_task_id);
+		}
+
+		for (auto *multi_base : worker_thread_multis) {
+			TBullet *multi = static_cast<TBullet *>(multi_base);
+
+			multi->apply_worker_thread_simulation_results();
+			multi->change_texture_periodically(delta);
+			multi->reduce_lifetime(delta);
+		}
+	}
+
+	// Frees a single multimesh from the pool (of any capacity if amount_bullets_per_instance is 0 or less). Returns false if there was nothing to free
+	template <typename TBullet>
+	bool free_single_pooled_multimesh_helper(std::vector<TBullet *> &bullets_vec, DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, int amount_bullets_per_instance) {
+		TBullet *pooled_multi = static_cast<TBullet *>(amount_bullets_per_instance > 0 ? bullets_pool.pop(amount_bullets_per_instance) : bullets_pool.pop_any());
+		if (pooled_multi == nullptr) {
+			return false;
+		}
+
+		pause_debugger_until_next_frame();
+
+		remove_multimesh_instance_from_vec_and_sparse_set<TBullet>(bullets_vec, sparse_set, pooled_multi);
+		pooled_multi->force_delete();
+
+		return true;
+	}
+
+	// Counts the active multimeshes of every size class of a single bullet type and advances the usage windows. Not limited by the time budget, so the windows of every size class always move at the same pace
 	template <typename TBullet>
-	void handle_bullet_rendering_interpolation(std::vector<TBullet *> &bullets_vec, const DynamicSparseSet &bullets_set) {
+	void update_bullets_pool_usage(const std::vector<TBullet *> &bullets_vec, const DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, std::map<int, BulletsPoolUsage> &pool_usage, bool is_new_window) {
+		// Multimeshes that were only ever created with populate_bullets_pool have no usage yet, so pick them up once per window
+		if (is_new_window) {
+			for (const auto &[amount_bullets_capacity, amount_pooled] : bullets_pool.get_pool_info()) {
+				pool_usage[amount_bullets_capacity];
+			}
+		}
+
+		for (auto &[amount_bullets_capacity, usage] : pool_usage) {
+			usage.amount_active = 0;
+		}
+
+		for (int index : sparse_set.get_active_indexes()) {
+			// Emitters never come from the pool, so they don't count towards its usage
+			if (bullets_vec[index]->get_is_emitter()) {
+				continue;
+			}
+
+			++pool_usage[bullets_vec[index]->get_amount_bullets_capacity()].amount_active;
+		}
+
+		for (auto it = pool_usage.begin(); it != pool_usage.end();) {
+			BulletsPoolUsage &usage = it->second;
+
+			if (is_new_window) {
+				usage.previous_window_peak = usage.window_peak;
+				usage.window_peak = usage.amount_active;
+			} else {
+				usage.window_peak = Math::max(usage.window_peak, usage.amount_active);
+			}
+
+			// Forget size classes that are no longer used at all
+			if (usage.window_peak == 0 && usage.previous_window_peak == 0 && bullets_pool.get_amount_pooled(it->first) == 0) {
+				it = pool_usage.erase(it);
+			} else {
+				++it;
+			}
+		}
+	}
+
+	// Grows/trims the object pool of a single bullet type towards the usage calculated by update_bullets_pool_usage. Returns false if the time budget ran out
+	template <typename TBullet>
+	bool auto_tune_bullets_pool(std::vector<TBullet *> &bullets_vec, DynamicSparseSet &sparse_set, MultiMeshObjectPool &bullets_pool, std::map<int, BulletsPoolUsage> &pool_usage, BulletsContainer2D &bullets_container, uint64_t budget_end_usec) {
+		Time *time = Time::get_singleton();
+
+		const uint64_t idle_time_msec = static_cast<uint64_t>(bullets_pool_auto_tuning_idle_time * 1000.0);
+		const uint64_t now_msec = time->get_ticks_msec();
+		const uint64_t pooled_before_msec = now_msec > idle_time_msec ? now_msec - idle_time_msec : 0;
+
+		for (auto &[amount_bullets_capacity, usage] : pool_usage) {
+			const int peak = Math::max(usage.window_peak, usage.previous_window_peak);
+			const int target_amount_total = static_cast<int>(Math::ceil(peak * (1.0 + bullets_pool_auto_tuning_headroom)));
+			const int target_amount_pooled = Math::max(target_amount_total - usage.amount_active, 0);
+
+			int amount_pooled = bullets_pool.get_amount_pooled(amount_bullets_capacity);
+
+			// Grow - only possible if the spawn data still produces multimeshes of this size class
+			const bool can_grow = usage.spawn_data.is_valid() && bullets_pool.get_size_class(usage.spawn_data->get_amount_bullets_to_spawn(usage.use_compiled_data)) == amount_bullets_capacity;
+
+			while (can_grow && amount_pooled < target_amount_pooled) {
+				if (time->get_ticks_usec() >= budget_end_usec) {
+					return false;
+				}
+
+				populate_bullets_pool_helper<TBullet>(usage.spawn_data, bullets_vec, bullets_pool, bullets_container, 1, usage.spawn_data->get_amount_bullets_to_spawn(usage.use_compiled_data), usage.use_compiled_data);
+				++amount_pooled;
+			}
+
+			// Trim - only multimeshes that have not been used for a while
+			while (amount_pooled > target_amount_pooled) {
+				if (time->get_ticks_usec() >= budget_end_usec) {
+					return false;
+				}
+
+				TBullet *idle_multi = static_cast<TBullet *>(bullets_pool.find_idle(amount_bullets_capacity, pooled_before_msec));
+				if (idle_multi == nullptr) {
+					break;
+				}
+
+				pause_debugger_until_next_frame();
+
+				bullets_pool.try_remove_instance(idle_multi, amount_bullets_capacity);
+				remove_multimesh_instance_from_vec_and_sparse_set<TBullet>(bullets_vec, sparse_set, idle_multi);
+				idle_multi->force_delete();
+
+				--amount_pooled;
+			}
+		}
+
+		return true;
+	}
+
+	// A single WorkerThreadPool task - moves a range of bullets of a single multimesh without touching any nodes or servers
+	template <typename TBullet>
+	void move_bullets_worker_thread_task(uint32_t task_index) {
+		const WorkerThreadTask &task = worker_thread_tasks[task_index];
+		static_cast<TBullet *>(task.multi)->move_bullets_range_on_worker_thread(task.range_index);
+	}
+
+	// Handles rendering - interpolates the bullet visuals if physics interpolation is enabled and uploads each multimesh's instance buffer to the rendering server with a single call
+	template <typename TBullet>
+	void handle_bullet_rendering(std::vector<TBullet *> &bullets_vec, const DynamicSparseSet &bullets_set) {
 		const auto &all_active_multis = bullets_set.get_active_indexes();
 
 		for (auto index : all_active_multis) {
 			auto &multi = bullets_vec[index];
-			multi->interpolate_bullet_visuals();
+
+			if (use_physics_interpolation) {
+				multi->interpolate_bullet_visuals();
+			}
+
+			multi->sync_instance_buffer();
 		}
 	}
 
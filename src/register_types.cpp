@@ -6,6 +6,7 @@
 // Shared
 #include "shared/bullet_attachment2d.hpp"
 #include "shared/bullet_curves_data2d.hpp"
+#include "shared/bullet_movement_pattern_data2d.hpp"
 #include "shared/bullet_rotation_data2d.hpp"
 #include "shared/bullet_speed_data2d.hpp"
 
@@ -38,6 +39,7 @@ void initialize_blast_bullets_2d_module(ModuleInitializationLevel p_level) {
 	GDREGISTER_CLASS(BulletRotationData2D)
 	GDREGISTER_CLASS(BulletSpeedData2D)
 	GDREGISTER_CLASS(BulletCurvesData2D)
+	GDREGISTER_INTERNAL_CLASS(BulletMovementPatternPath2D)
 	GDREGISTER_RUNTIME_CLASS(BulletAttachment2D)
 
 	// Factory
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "godot_cpp/core/defs.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// A bounded lock-free queue that many threads can push to while a single thread pops from it. Every cell has a sequence number that tells the producers whether the cell is free and the consumer whether it's filled, so neither side ever takes a lock.
+// When the queue is full the value is dropped and counted as an overflow instead of blocking the producer
+template <typename T>
+class BoundedMPSCQueue {
+private:
+	struct Cell {
+		std::atomic<uint64_t> sequence{ 0 };
+		T data;
+	};
+
+	std::unique_ptr<Cell[]> cells;
+	uint64_t mask = 0;
+
+	// Producers and the consumer are kept on separate cache lines so they don't slow each other down
+	alignas(64) std::atomic<uint64_t> enqueue_position{ 0 };
+	alignas(64) uint64_t dequeue_position = 0;
+
+	std::atomic<uint64_t> amount_overflowed{ 0 };
+
+public:
+	// Allocates the queue with at least the given capacity (rounded up to a power of 2) and empties it. NOT thread-safe - call only while nothing pushes to the queue
+	_ALWAYS_INLINE_ void reset(int min_capacity) {
+		uint64_t capacity = 2;
+		while (capacity < static_cast<uint64_t>(min_capacity)) {
+			capacity <<= 1;
+		}
+
+		cells.reset(new Cell[capacity]);
+		mask = capacity - 1;
+
+		for (uint64_t i = 0; i < capacity; ++i) {
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		enqueue_position.store(0, std::memory_order_relaxed);
+		dequeue_position = 0;
+		amount_overflowed.store(0, std::memory_order_relaxed);
+	}
+
+	_ALWAYS_INLINE_ int get_capacity() const {
+		return cells ? static_cast<int>(mask + 1) : 0;
+	}
+
+	// Thread-safe. Returns false if the queue was full, in which case the value is dropped and counted as an overflow
+	_ALWAYS_INLINE_ bool push(const T &value) {
+		uint64_t position = enqueue_position.load(std::memory_order_relaxed);
+
+		while (true) {
+			Cell &cell = cells[position & mask];
+			const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const int64_t difference = static_cast<int64_t>(sequence - position);
+
+			if (difference == 0) {
+				// The cell is free - claim it (on failure the position gets reloaded, since another producer claimed it first)
+				if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					cell.data = value;
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (difference < 0) {
+				// The cell still holds a value from the previous lap, so the queue is full
+				amount_overflowed.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			} else {
+				position = enqueue_position.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Consumer thread only. Returns false if the queue is empty
+	_ALWAYS_INLINE_ bool pop(T &value) {
+		Cell &cell = cells[dequeue_position & mask];
+		const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+		// The producer that claimed this cell hasn't finished writing to it yet (or nobody claimed it)
+		if (static_cast<int64_t>(sequence - (dequeue_position + 1)) < 0) {
+			return false;
+		}
+
+		value = cell.data;
+
+		// Free the cell for the producers of the next lap
+		cell.sequence.store(dequeue_position + mask + 1, std::memory_order_release);
+		++dequeue_position;
+
+		return true;
+	}
+
+	// How many values were dropped because the queue was full
+	_ALWAYS_INLINE_ uint64_t get_amount_overflowed() const {
+		return amount_overflowed.load(std::memory_order_relaxed);
+	}
+};
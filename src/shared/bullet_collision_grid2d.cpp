@@ -0,0 +1,264 @@
+#include "./bullet_collision_grid2d.hpp"
+
+#include "../bullets/multimesh_bullets2d.hpp"
+#include "godot_cpp/classes/physics_server2d.hpp"
+#include "godot_cpp/core/object.hpp"
+#include "godot_cpp/variant/transform2d.hpp"
+#include <algorithm>
+
+using namespace godot;
+
+namespace BlastBullets2D {
+
+void BulletCollisionGrid2D::add_target(Node2D *target, const Vector2 &size, uint32_t collision_layer, bool is_body) {
+	if (target == nullptr) {
+		return;
+	}
+
+	// Registering the same target again only updates its data
+	remove_target(target);
+
+	Target new_target;
+	new_target.node_instance_id = target->get_instance_id();
+	new_target.is_rid_target = false;
+	new_target.is_body = is_body;
+	new_target.half_extents = size.abs() / 2;
+	new_target.collision_layer = collision_layer;
+	new_target.key = new_target.node_instance_id;
+
+	all_targets.emplace_back(new_target);
+}
+
+void BulletCollisionGrid2D::add_target_rid(const RID &target_rid, const Vector2 &size, uint32_t collision_layer, bool is_body) {
+	if (!target_rid.is_valid()) {
+		return;
+	}
+
+	remove_target_rid(target_rid);
+
+	Target new_target;
+	new_target.rid = target_rid;
+	new_target.is_rid_target = true;
+	new_target.is_body = is_body;
+	new_target.half_extents = size.abs() / 2;
+	new_target.collision_layer = collision_layer;
+	new_target.key = target_rid.get_id();
+
+	all_targets.emplace_back(new_target);
+}
+
+void BulletCollisionGrid2D::remove_target(Node2D *target) {
+	if (target == nullptr) {
+		return;
+	}
+
+	const uint64_t node_instance_id = target->get_instance_id();
+
+	all_targets.erase(
+			std::remove_if(all_targets.begin(), all_targets.end(), [node_instance_id](const Target &curr_target) {
+				return !curr_target.is_rid_target && curr_target.node_instance_id == node_instance_id;
+			}),
+			all_targets.end());
+}
+
+void BulletCollisionGrid2D::remove_target_rid(const RID &target_rid) {
+	all_targets.erase(
+			std::remove_if(all_targets.begin(), all_targets.end(), [&target_rid](const Target &curr_target) {
+				return curr_target.is_rid_target && curr_target.rid == target_rid;
+			}),
+			all_targets.end());
+}
+
+void BulletCollisionGrid2D::clear_targets() {
+	all_targets.clear();
+}
+
+int BulletCollisionGrid2D::get_targets_amount() const {
+	return static_cast<int>(all_targets.size());
+}
+
+void BulletCollisionGrid2D::clear_overlaps() {
+	previous_overlaps.clear();
+	current_overlaps.clear();
+}
+
+void BulletCollisionGrid2D::begin_frame() {
+	all_multimeshes.clear();
+	all_bullets.clear();
+	max_bullet_half_extents = Vector2(0, 0);
+}
+
+int BulletCollisionGrid2D::register_multimesh(MultiMeshBullets2D *multimesh, const Vector2 &collision_shape_half_extents, uint32_t collision_mask) {
+	all_multimeshes.emplace_back(MultiMeshEntry{ multimesh, collision_shape_half_extents, collision_mask });
+
+	max_bullet_half_extents.x = Math::max(max_bullet_half_extents.x, collision_shape_half_extents.x);
+	max_bullet_half_extents.y = Math::max(max_bullet_half_extents.y, collision_shape_half_extents.y);
+
+	return static_cast<int>(all_multimeshes.size()) - 1;
+}
+
+void BulletCollisionGrid2D::refresh_targets() {
+	PhysicsServer2D *physics_server = PhysicsServer2D::get_singleton();
+
+	for (size_t i = 0; i < all_targets.size();) {
+		Target &target = all_targets[i];
+
+		if (target.is_rid_target) {
+			const int64_t rid_instance_id = target.is_body ? physics_server->body_get_object_instance_id(target.rid) : physics_server->area_get_object_instance_id(target.rid);
+
+			// The server rejects a freed RID - it has no object instance and no space. A RID that was never attached to an object is only kept while it's inside a space, since nothing can collide with it otherwise
+			if (rid_instance_id == 0) {
+				const RID space = target.is_body ? physics_server->body_get_space(target.rid) : physics_server->area_get_space(target.rid);
+
+				if (!space.is_valid()) {
+					target = all_targets.back();
+					all_targets.pop_back();
+					continue;
+				}
+			}
+
+			if (target.is_body) {
+				const Transform2D body_transf = physics_server->body_get_state(target.rid, PhysicsServer2D::BODY_STATE_TRANSFORM);
+				target.position = body_transf.get_origin();
+			} else {
+				target.position = physics_server->area_get_transform(target.rid).get_origin();
+			}
+			target.instance_id = rid_instance_id;
+		} else {
+			Node2D *node = Object::cast_to<Node2D>(ObjectDB::get_instance(target.node_instance_id));
+
+			// The node was freed, so stop tracking it
+			if (node == nullptr) {
+				target = all_targets.back();
+				all_targets.pop_back();
+				continue;
+			}
+
+			target.position = node->get_global_position();
+			target.instance_id = static_cast<int64_t>(target.node_instance_id);
+		}
+
+		++i;
+	}
+}
+
+uint32_t BulletCollisionGrid2D::build_buckets(real_t inverse_cell_size) {
+	const int amount_bullets = static_cast<int>(all_bullets.size());
+
+	// Keep the buckets at least twice the amount of bullets so that most buckets hold a single grid cell
+	uint32_t amount_buckets = 64;
+	while (amount_buckets < static_cast<uint32_t>(amount_bullets) * 2) {
+		amount_buckets <<= 1;
+	}
+	const uint32_t bucket_mask = amount_buckets - 1;
+
+	bucket_starts.assign(amount_buckets + 1, 0);
+	bullet_buckets.resize(amount_bullets);
+
+	// Count the bullets in each bucket
+	for (int i = 0; i < amount_bullets; ++i) {
+		const Vector2 &position = all_bullets[i].position;
+		const uint32_t bucket = get_bucket(get_cell_coordinate(position.x, inverse_cell_size), get_cell_coordinate(position.y, inverse_cell_size), bucket_mask);
+
+		bullet_buckets[i] = bucket;
+		++bucket_starts[bucket + 1];
+	}
+
+	for (uint32_t bucket = 0; bucket < amount_buckets; ++bucket) {
+		bucket_starts[bucket + 1] += bucket_starts[bucket];
+	}
+
+	// Place each bullet in its bucket
+	bucket_cursors.assign(bucket_starts.begin(), bucket_starts.end() - 1);
+	sorted_bullets.resize(amount_bullets);
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		sorted_bullets[bucket_cursors[bullet_buckets[i]]++] = all_bullets[i];
+	}
+
+	return bucket_mask;
+}
+
+void BulletCollisionGrid2D::test_bullets_against_target(int sorted_bullets_begin, int sorted_bullets_end, int target_index) {
+	const Target &target = all_targets[target_index];
+
+	for (int i = sorted_bullets_begin; i < sorted_bullets_end; ++i) {
+		const BulletEntry &bullet = sorted_bullets[i];
+		const MultiMeshEntry &multimesh_entry = all_multimeshes[bullet.multimesh_slot];
+
+		// Same rule as an area monitoring other objects - the bullets detect targets whose layer is inside their mask
+		if ((multimesh_entry.collision_mask & target.collision_layer) == 0) {
+			continue;
+		}
+
+		const Vector2 distance = (bullet.position - target.position).abs();
+		if (distance.x > multimesh_entry.half_extents.x + target.half_extents.x || distance.y > multimesh_entry.half_extents.y + target.half_extents.y) {
+			continue;
+		}
+
+		current_overlaps.emplace_back(Overlap{ multimesh_entry.multimesh, bullet.bullet_index, target.key, target_index });
+	}
+}
+
+void BulletCollisionGrid2D::detect_collisions() {
+	current_overlaps.clear();
+
+	refresh_targets();
+
+	if (!all_targets.empty() && !all_bullets.empty()) {
+		const real_t inverse_cell_size = 1.0 / Math::max(cell_size, static_cast<real_t>(1.0));
+		const uint32_t bucket_mask = build_buckets(inverse_cell_size);
+
+		const int amount_targets = static_cast<int>(all_targets.size());
+
+		for (int target_index = 0; target_index < amount_targets; ++target_index) {
+			const Target &target = all_targets[target_index];
+
+			// Every bullet whose origin is inside this area can overlap the target
+			const Vector2 reach = target.half_extents + max_bullet_half_extents;
+			const int min_cell_x = get_cell_coordinate(target.position.x - reach.x, inverse_cell_size);
+			const int min_cell_y = get_cell_coordinate(target.position.y - reach.y, inverse_cell_size);
+			const int max_cell_x = get_cell_coordinate(target.position.x + reach.x, inverse_cell_size);
+			const int max_cell_y = get_cell_coordinate(target.position.y + reach.y, inverse_cell_size);
+
+			const int64_t amount_cells = static_cast<int64_t>(max_cell_x - min_cell_x + 1) * (max_cell_y - min_cell_y + 1);
+
+			// A target that covers more cells than there are buckets would visit every bucket anyway, so just test all bullets
+			if (amount_cells > static_cast<int64_t>(bucket_mask) + 1) {
+				test_bullets_against_target(0, static_cast<int>(sorted_bullets.size()), target_index);
+				continue;
+			}
+
+			for (int cell_y = min_cell_y; cell_y <= max_cell_y; ++cell_y) {
+				for (int cell_x = min_cell_x; cell_x <= max_cell_x; ++cell_x) {
+					const uint32_t bucket = get_bucket(cell_x, cell_y, bucket_mask);
+					test_bullets_against_target(bucket_starts[bucket], bucket_starts[bucket + 1], target_index);
+				}
+			}
+		}
+	}
+
+	// Different grid cells can share a bucket, so the same overlap might have been found more than once
+	std::sort(current_overlaps.begin(), current_overlaps.end());
+	current_overlaps.erase(std::unique(current_overlaps.begin(), current_overlaps.end()), current_overlaps.end());
+
+	// Report only the overlaps that started in this physics frame
+	for (const Overlap &overlap : current_overlaps) {
+		if (std::binary_search(previous_overlaps.begin(), previous_overlaps.end(), overlap)) {
+			continue;
+		}
+
+		const Target &target = all_targets[overlap.target_index];
+		overlap.multimesh->queue_collision_grid_collision(overlap.bullet_index, target.instance_id, target.is_body);
+	}
+
+	previous_overlaps.swap(current_overlaps);
+}
+
+void BulletCollisionGrid2D::handle_detected_collisions() {
+	for (const MultiMeshEntry &multimesh_entry : all_multimeshes) {
+		multimesh_entry.multimesh->handle_all_collided_bullets();
+	}
+}
+
+} //namespace BlastBullets2D
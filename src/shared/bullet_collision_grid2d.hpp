@@ -0,0 +1,149 @@
+#pragma once
+
+#include "godot_cpp/classes/node2d.hpp"
+#include "godot_cpp/core/defs.hpp"
+#include "godot_cpp/core/math.hpp"
+#include "godot_cpp/variant/rid.hpp"
+#include "godot_cpp/variant/vector2.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace BlastBullets2D {
+using namespace godot;
+
+class MultiMeshBullets2D;
+
+// A collision backend that doesn't use the physics server at all. Every physics frame the collision shapes of all bullets are hashed into a uniform grid and each registered target only tests the bullets inside the grid cells it overlaps.
+// Bullets and targets are tested as axis-aligned rectangles (the rotation of the collision shapes is ignored). A collision is reported only in the physics frame in which a bullet starts overlapping a target, same as the physics server reports area/body entered
+class BulletCollisionGrid2D {
+public:
+	// The size of a single grid cell. Works best when it's a bit bigger than the bullets
+	real_t cell_size = 64.0;
+
+	// Registers a node as a collision target. Its global position is read every physics frame
+	void add_target(Node2D *target, const Vector2 &size, uint32_t collision_layer, bool is_body);
+
+	// Registers a physics server body or area as a collision target. Its transform is read from the physics server every physics frame
+	void add_target_rid(const RID &target_rid, const Vector2 &size, uint32_t collision_layer, bool is_body);
+
+	void remove_target(Node2D *target);
+	void remove_target_rid(const RID &target_rid);
+	void clear_targets();
+	int get_targets_amount() const;
+
+	// Forgets which bullets are currently overlapping targets
+	void clear_overlaps();
+
+	// Starts a new physics frame. Call before inserting any bullets
+	void begin_frame();
+
+	// Registers a multimesh whose bullets are about to be inserted and returns the slot that has to be passed to insert_bullet
+	int register_multimesh(MultiMeshBullets2D *multimesh, const Vector2 &collision_shape_half_extents, uint32_t collision_mask);
+
+	_ALWAYS_INLINE_ void insert_bullet(int multimesh_slot, int bullet_index, const Vector2 &collision_shape_origin) {
+		all_bullets.emplace_back(BulletEntry{ collision_shape_origin, multimesh_slot, bullet_index });
+	}
+
+	// Hashes all inserted bullets, tests them against every target and queues a collision inside each multimesh for every bullet that started overlapping a target in this physics frame
+	void detect_collisions();
+
+	// Lets every multimesh that was registered during this frame handle its queued collisions (emits the collision signals)
+	void handle_detected_collisions();
+
+private:
+	struct Target {
+		// The node of the target. Not used for RID targets
+		uint64_t node_instance_id = 0;
+
+		// The physics server RID of the target. Not used for node targets
+		RID rid;
+
+		bool is_rid_target = false;
+		bool is_body = false;
+
+		Vector2 half_extents;
+		uint32_t collision_layer = 0;
+
+		// Identifies the target between physics frames - the instance id of the node or the id of the RID
+		uint64_t key = 0;
+
+		// Refreshed every physics frame
+		Vector2 position;
+		int64_t instance_id = 0;
+	};
+
+	struct MultiMeshEntry {
+		MultiMeshBullets2D *multimesh = nullptr;
+		Vector2 half_extents;
+		uint32_t collision_mask = 0;
+	};
+
+	struct BulletEntry {
+		Vector2 position;
+		int multimesh_slot = -1;
+		int bullet_index = -1;
+	};
+
+	// A bullet that overlaps a target. Compared between physics frames in order to only report newly started overlaps
+	struct Overlap {
+		MultiMeshBullets2D *multimesh = nullptr;
+		int bullet_index = -1;
+		uint64_t target_key = 0;
+
+		// Only valid during the frame in which the overlap was detected
+		int target_index = -1;
+
+		_ALWAYS_INLINE_ bool operator<(const Overlap &other) const {
+			if (multimesh != other.multimesh) {
+				return reinterpret_cast<uintptr_t>(multimesh) < reinterpret_cast<uintptr_t>(other.multimesh);
+			}
+			if (bullet_index != other.bullet_index) {
+				return bullet_index < other.bullet_index;
+			}
+			return target_key < other.target_key;
+		}
+
+		_ALWAYS_INLINE_ bool operator==(const Overlap &other) const {
+			return multimesh == other.multimesh && bullet_index == other.bullet_index && target_key == other.target_key;
+		}
+	};
+
+	std::vector<Target> all_targets;
+
+	std::vector<MultiMeshEntry> all_multimeshes;
+
+	// The bullets inserted during the current frame
+	std::vector<BulletEntry> all_bullets;
+
+	// The bullets sorted by their hash bucket (counting sort), bucket_starts[b] is where the bullets of bucket b begin inside sorted_bullets
+	std::vector<BulletEntry> sorted_bullets;
+	std::vector<int> bucket_starts;
+
+	// Scratch memory for build_buckets (kept around so it doesn't get re-allocated every frame)
+	std::vector<uint32_t> bullet_buckets;
+	std::vector<int> bucket_cursors;
+
+	// The biggest bullet half extents across all registered multimeshes. Targets expand their query area by this much so that no bullet gets missed
+	Vector2 max_bullet_half_extents;
+
+	std::vector<Overlap> previous_overlaps;
+	std::vector<Overlap> current_overlaps;
+
+	_ALWAYS_INLINE_ int get_cell_coordinate(real_t value, real_t inverse_cell_size) const {
+		return static_cast<int>(Math::floor(value * inverse_cell_size));
+	}
+
+	_ALWAYS_INLINE_ uint32_t get_bucket(int cell_x, int cell_y, uint32_t bucket_mask) const {
+		return ((static_cast<uint32_t>(cell_x) * 73856093u) ^ (static_cast<uint32_t>(cell_y) * 19349663u)) & bucket_mask;
+	}
+
+	// Refreshes the position and instance id of every target and removes the ones that were freed
+	void refresh_targets();
+
+	// Hashes all bullets into buckets and returns the bucket mask
+	uint32_t build_buckets(real_t inverse_cell_size);
+
+	// Tests a range of sorted_bullets against a single target and records the overlaps
+	void test_bullets_against_target(int sorted_bullets_begin, int sorted_bullets_end, int target_index);
+};
+} //namespace BlastBullets2D
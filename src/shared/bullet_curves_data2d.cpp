@@ -1,41 +1,80 @@
 #include "./bullet_curves_data2d.hpp"
 
+#include "godot_cpp/variant/callable_method_pointer.hpp"
+
 using namespace godot;
 
 namespace BlastBullets2D {
 
+void CurveLookupTable::bake(const Ref<Curve> &curve) {
+	if (curve.is_null()) {
+		values.clear();
+		return;
+	}
+
+	min_domain = curve->get_min_domain();
+	max_domain = curve->get_max_domain();
+
+	const real_t domain_range = max_domain - min_domain;
+	samples_per_unit = domain_range > CMP_EPSILON ? (RESOLUTION - 1) / domain_range : 0.0;
+
+	values.resize(RESOLUTION);
+	for (int i = 0; i < RESOLUTION; ++i) {
+		const real_t offset = min_domain + domain_range * i / (RESOLUTION - 1);
+		values[i] = static_cast<float>(curve->sample_baked(offset));
+	}
+}
+
+void BulletCurvesData2D::replace_curve(Ref<Curve> &curve_member, const Ref<Curve> &new_curve, CurveLookupTable &lut, const Callable &on_curve_changed) {
+	if (curve_member.is_valid() && curve_member->is_connected("changed", on_curve_changed)) {
+		curve_member->disconnect("changed", on_curve_changed);
+	}
+
+	curve_member = new_curve;
+
+	if (curve_member.is_valid()) {
+		curve_member->connect("changed", on_curve_changed);
+	}
+
+	lut.bake(curve_member);
+}
+
+void BulletCurvesData2D::on_movement_speed_curve_changed() {
+	movement_speed_lut.bake(movement_speed_curve);
+}
+
+void BulletCurvesData2D::on_rotation_speed_curve_changed() {
+	rotation_speed_lut.bake(rotation_speed_curve);
+}
+
+void BulletCurvesData2D::on_x_direction_curve_changed() {
+	x_direction_lut.bake(x_direction_curve);
+}
+
+void BulletCurvesData2D::on_y_direction_curve_changed() {
+	y_direction_lut.bake(y_direction_curve);
+}
+
 Ref<Curve> BulletCurvesData2D::get_movement_speed_curve() const {
 	return movement_speed_curve;
 }
 
 void BulletCurvesData2D::set_movement_speed_curve(const Ref<Curve> &curve) {
-	if (curve.is_valid()) {
-		curve->bake();
-	}
-
-	movement_speed_curve = curve;
+	replace_curve(movement_speed_curve, curve, movement_speed_lut, callable_mp(this, &BulletCurvesData2D::on_movement_speed_curve_changed));
 }
 
 Ref<Curve> BulletCurvesData2D::get_rotation_speed_curve() const {
 	return rotation_speed_curve;
 }
 void BulletCurvesData2D::set_rotation_speed_curve(const Ref<Curve> &curve) {
-	if (curve.is_valid()) {
-		curve->bake();
-	}
-
-	rotation_speed_curve = curve;
+	replace_curve(rotation_speed_curve, curve, rotation_speed_lut, callable_mp(this, &BulletCurvesData2D::on_rotation_speed_curve_changed));
 }
 
 Ref<Curve> BulletCurvesData2D::get_x_direction_curve() const {
 	return x_direction_curve;
 }
 void BulletCurvesData2D::set_x_direction_curve(const Ref<Curve> &curve) {
-	if (curve.is_valid()) {
-		curve->bake();
-	}
-
-	x_direction_curve = curve;
+	replace_curve(x_direction_curve, curve, x_direction_lut, callable_mp(this, &BulletCurvesData2D::on_x_direction_curve_changed));
 }
 
 bool BulletCurvesData2D::get_movement_use_unit_curve() const {
@@ -94,11 +133,7 @@ Ref<Curve> BulletCurvesData2D::get_y_direction_curve() const {
 	return y_direction_curve;
 }
 void BulletCurvesData2D::set_y_direction_curve(const Ref<Curve> &curve) {
-	if (curve.is_valid()) {
-		curve->bake();
-	}
-
-	y_direction_curve = curve;
+	replace_curve(y_direction_curve, curve, y_direction_lut, callable_mp(this, &BulletCurvesData2D::on_y_direction_curve_changed));
 }
 
 bool BulletCurvesData2D::get_y_direction_use_unit_curve() const {
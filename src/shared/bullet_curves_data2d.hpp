@@ -1,8 +1,11 @@
 #pragma once
 
 #include "godot_cpp/classes/curve.hpp"
+#include "godot_cpp/core/defs.hpp"
+#include "godot_cpp/core/math.hpp"
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
+#include <vector>
 
 namespace BlastBullets2D {	
 using namespace godot;
@@ -13,6 +16,30 @@ enum DirectionCurveMode {
 	Override
 };
 
+// A curve baked into a fixed amount of evenly spaced samples. Sampling it is a clamp, a multiplication and a lerp between two neighbouring samples, so bullets never have to call into the Curve object while moving
+struct CurveLookupTable {
+	static constexpr int RESOLUTION = 256;
+
+	std::vector<float> values;
+	real_t min_domain = 0.0;
+	real_t max_domain = 1.0;
+	real_t samples_per_unit = 0.0;
+
+	void bake(const Ref<Curve> &curve);
+
+	// Same result as curve->sample_baked(offset), linearly interpolated between the baked samples
+	_ALWAYS_INLINE_ real_t sample(real_t offset) const {
+		const real_t position = (Math::clamp(offset, min_domain, max_domain) - min_domain) * samples_per_unit;
+		const int index = static_cast<int>(position);
+
+		if (index >= RESOLUTION - 1) {
+			return values[RESOLUTION - 1];
+		}
+
+		return Math::lerp(static_cast<real_t>(values[index]), static_cast<real_t>(values[index + 1]), position - index);
+	}
+};
+
 class BulletCurvesData2D : public Resource {
 	GDCLASS(BulletCurvesData2D, Resource)
 
@@ -36,6 +63,12 @@ public:
 	bool rotate_towards_adjusted_direction = true;
 	real_t direction_curve_rotation_speed = 18.0f;
 
+	// The baked versions of the curves above. They are re-baked whenever a curve emits its changed signal
+	CurveLookupTable movement_speed_lut;
+	CurveLookupTable rotation_speed_lut;
+	CurveLookupTable x_direction_lut;
+	CurveLookupTable y_direction_lut;
+
 	Ref<Curve> get_movement_speed_curve() const;
 	void set_movement_speed_curve(const Ref<Curve> &curve);
 
@@ -80,6 +113,15 @@ public:
 
 protected:
 	static void _bind_methods();
+
+private:
+	// Replaces the curve, moves the changed signal connection from the old curve to the new one and bakes the lookup table
+	void replace_curve(Ref<Curve> &curve_member, const Ref<Curve> &new_curve, CurveLookupTable &lut, const Callable &on_curve_changed);
+
+	void on_movement_speed_curve_changed();
+	void on_rotation_speed_curve_changed();
+	void on_x_direction_curve_changed();
+	void on_y_direction_curve_changed();
 };
 } //namespace BlastBullets2D
 
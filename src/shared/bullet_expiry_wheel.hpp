@@ -0,0 +1,136 @@
+#pragma once
+
+#include "godot_cpp/core/defs.hpp"
+#include "godot_cpp/core/math.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Schedules per-bullet lifetimes in a hashed timing wheel. Time is split into fixed ticks and every bullet is placed into the bucket of the tick it expires in, so advancing the time only touches the buckets of the ticks that passed (and the bullets inside them) instead of every bullet.
+// Lifetimes longer than a full revolution of the wheel simply stay in their bucket until the revolution in which they expire
+class BulletExpiryWheel {
+public:
+	// The duration of a single tick in seconds. Bullets expire at the first tick after their lifetime is over
+	static constexpr double TICK_DURATION = 1.0 / 60.0;
+
+	// A bullet whose lifetime is over, together with the tick it expired at (used to check whether the lifetime is still the same one when the bullet is about to be disabled)
+	using ExpiredBullet = std::pair<int, int64_t>;
+
+	// Resizes the wheel so it can hold lifetimes for the given amount of bullets
+	_ALWAYS_INLINE_ void resize(int amount_bullets) {
+		expiry_tick_of_bullet.resize(amount_bullets, NO_EXPIRY);
+	}
+
+	// Schedules the bullet to expire after the given lifetime, replacing its old lifetime if it had one
+	_ALWAYS_INLINE_ void schedule(int bullet_index, double life_time) {
+		if (buckets.empty()) {
+			buckets.resize(AMOUNT_BUCKETS);
+		}
+
+		const int64_t expiry_tick = std::max(static_cast<int64_t>(Math::ceil((elapsed_time + life_time) / TICK_DURATION)), current_tick + 1);
+
+		// The old entry (if there was one) stays in its bucket and gets dropped once its tick is reached, since it no longer matches the bullet's expiry tick
+		expiry_tick_of_bullet[bullet_index] = expiry_tick;
+		buckets[expiry_tick & BUCKET_MASK].emplace_back(Entry{ bullet_index, expiry_tick });
+		++amount_entries;
+	}
+
+	// Removes the lifetime of a bullet. Safe to call with any bullet index
+	_ALWAYS_INLINE_ void cancel(int bullet_index) {
+		if (bullet_index >= 0 && bullet_index < static_cast<int>(expiry_tick_of_bullet.size())) {
+			expiry_tick_of_bullet[bullet_index] = NO_EXPIRY;
+		}
+	}
+
+	// Whether the expired bullet still has the same lifetime it had when it expired (the lifetime wasn't replaced or cancelled since then)
+	_ALWAYS_INLINE_ bool is_still_expired(const ExpiredBullet &expired_bullet) const {
+		return expiry_tick_of_bullet[expired_bullet.first] == expired_bullet.second;
+	}
+
+	_ALWAYS_INLINE_ bool has_life_time(int bullet_index) const {
+		return bullet_index >= 0 && bullet_index < static_cast<int>(expiry_tick_of_bullet.size()) && expiry_tick_of_bullet[bullet_index] != NO_EXPIRY;
+	}
+
+	// The lifetime the bullet has left in seconds or -1 if it doesn't have a lifetime
+	_ALWAYS_INLINE_ double get_life_time_left(int bullet_index) const {
+		if (!has_life_time(bullet_index)) {
+			return -1.0;
+		}
+
+		return Math::max(expiry_tick_of_bullet[bullet_index] * TICK_DURATION - elapsed_time, 0.0);
+	}
+
+	// Whether nothing is scheduled, in which case advancing the time can be skipped entirely
+	_ALWAYS_INLINE_ bool empty() const {
+		return amount_entries == 0;
+	}
+
+	// Advances the time and appends every bullet whose lifetime is over to expired_bullets
+	_ALWAYS_INLINE_ void advance(double delta, std::vector<ExpiredBullet> &expired_bullets) {
+		elapsed_time += delta;
+
+		const int64_t new_tick = static_cast<int64_t>(elapsed_time / TICK_DURATION);
+
+		// A huge delta would visit the same buckets multiple times, so visit each bucket at most once
+		const int64_t first_tick = std::max<int64_t>(current_tick + 1, new_tick - AMOUNT_BUCKETS + 1);
+
+		for (int64_t tick = first_tick; tick <= new_tick; ++tick) {
+			std::vector<Entry> &bucket = buckets[tick & BUCKET_MASK];
+
+			for (size_t i = 0; i < bucket.size();) {
+				const Entry &entry = bucket[i];
+
+				// Expires in a later revolution of the wheel
+				if (entry.expiry_tick > new_tick) {
+					++i;
+					continue;
+				}
+
+				if (expiry_tick_of_bullet[entry.bullet_index] == entry.expiry_tick) {
+					expired_bullets.emplace_back(entry.bullet_index, entry.expiry_tick);
+				}
+
+				bucket[i] = bucket.back();
+				bucket.pop_back();
+				--amount_entries;
+			}
+		}
+
+		current_tick = new_tick;
+	}
+
+	// Removes all lifetimes. The wheel keeps its size so it can be reused
+	_ALWAYS_INLINE_ void clear() {
+		for (std::vector<Entry> &bucket : buckets) {
+			bucket.clear();
+		}
+
+		expiry_tick_of_bullet.assign(expiry_tick_of_bullet.size(), NO_EXPIRY);
+		amount_entries = 0;
+		elapsed_time = 0.0;
+		current_tick = 0;
+	}
+
+private:
+	static constexpr int AMOUNT_BUCKETS = 256; // Has to be a power of 2
+	static constexpr int64_t BUCKET_MASK = AMOUNT_BUCKETS - 1;
+	static constexpr int64_t NO_EXPIRY = -1;
+
+	struct Entry {
+		int bullet_index = -1;
+		int64_t expiry_tick = 0;
+	};
+
+	// Allocated only once the first lifetime gets scheduled
+	std::vector<std::vector<Entry>> buckets;
+
+	// For every bullet index - the tick in which the bullet expires or NO_EXPIRY
+	std::vector<int64_t> expiry_tick_of_bullet;
+
+	// The amount of entries inside all buckets (including the ones that were replaced or cancelled and haven't been dropped yet)
+	int amount_entries = 0;
+
+	double elapsed_time = 0.0;
+	int64_t current_tick = 0;
+};
@@ -0,0 +1,96 @@
+#include "./bullet_movement_pattern_data2d.hpp"
+
+#include "godot_cpp/variant/callable_method_pointer.hpp"
+#include <mutex>
+#include <unordered_map>
+
+using namespace godot;
+
+namespace BlastBullets2D {
+
+// All paths that are currently used by bullets, keyed by the instance id of their curve. A path removes itself when the last bullet using it lets go of it
+static std::unordered_map<uint64_t, BulletMovementPatternPath2D *> all_shared_paths;
+
+// Paths are released whenever a bullet lets go of its movement pattern, which also happens while the bullets are moved on worker threads
+static std::mutex all_shared_paths_mutex;
+
+Ref<BulletMovementPatternPath2D> BulletMovementPatternPath2D::get_or_create(const Ref<Curve2D> &curve) {
+	if (curve.is_null()) {
+		return Ref<BulletMovementPatternPath2D>();
+	}
+
+	const uint64_t curve_id = curve->get_instance_id();
+
+	std::lock_guard<std::mutex> lock(all_shared_paths_mutex);
+
+	auto it = all_shared_paths.find(curve_id);
+	if (it != all_shared_paths.end()) {
+		// If the last reference was just released on another thread, the path is about to be destroyed and can't be referenced anymore (the Ref stays null), so a new one gets created instead
+		Ref<BulletMovementPatternPath2D> existing_path(it->second);
+		if (existing_path.is_valid()) {
+			return existing_path;
+		}
+	}
+
+	Ref<BulletMovementPatternPath2D> path;
+	path.instantiate();
+	path->curve = curve;
+	path->bake();
+
+	curve->connect("changed", callable_mp(path.ptr(), &BulletMovementPatternPath2D::bake));
+
+	all_shared_paths[curve_id] = path.ptr();
+
+	return path;
+}
+
+BulletMovementPatternPath2D::~BulletMovementPatternPath2D() {
+	if (curve.is_null()) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(all_shared_paths_mutex);
+
+		// The curve might already be used by a newer path that was created while this one was being destroyed
+		auto it = all_shared_paths.find(curve->get_instance_id());
+		if (it != all_shared_paths.end() && it->second == this) {
+			all_shared_paths.erase(it);
+		}
+	}
+
+	const Callable on_curve_changed = callable_mp(this, &BulletMovementPatternPath2D::bake);
+	if (curve->is_connected("changed", on_curve_changed)) {
+		curve->disconnect("changed", on_curve_changed);
+	}
+}
+
+void BulletMovementPatternPath2D::bake() {
+	length = curve->get_baked_length();
+
+	// Curves without a length can't move the bullets
+	if (length <= CMP_EPSILON) {
+		length = 0.0;
+		points_per_unit = 0.0;
+		points.assign(2, Vector2());
+		start_to_end = Vector2();
+		return;
+	}
+
+	// Space the points the same way the curve itself is baked
+	const real_t bake_interval = Math::max(curve->get_bake_interval(), static_cast<real_t>(CMP_EPSILON));
+	const int amount_points = Math::clamp(static_cast<int>(Math::ceil(length / bake_interval)) + 1, 2, MAX_POINTS);
+
+	points_per_unit = (amount_points - 1) / length;
+
+	const Vector2 start = curve->sample_baked(0.0);
+
+	points.resize(amount_points);
+	for (int i = 0; i < amount_points; ++i) {
+		points[i] = curve->sample_baked(length * i / (amount_points - 1)) - start;
+	}
+
+	start_to_end = points.back();
+}
+
+} //namespace BlastBullets2D
@@ -2,11 +2,74 @@
 
 #include "godot_cpp/classes/curve2d.hpp"
 #include "godot_cpp/classes/path2d.hpp"
+#include "godot_cpp/classes/ref_counted.hpp"
+#include "godot_cpp/core/defs.hpp"
+#include "godot_cpp/core/math.hpp"
+#include "godot_cpp/variant/vector2.hpp"
+#include <vector>
+
+namespace BlastBullets2D {
+using namespace godot;
+
+// The arc-length data of a Curve2D that is used as a movement pattern. Baked once per curve and shared by every bullet (in every multimesh) that uses the same curve. Re-baked whenever the curve emits its changed signal
+class BulletMovementPatternPath2D : public RefCounted {
+	GDCLASS(BulletMovementPatternPath2D, RefCounted)
+
+public:
+	// Upper limit for the amount of points, so that very long curves with a tiny bake interval don't eat memory
+	static constexpr int MAX_POINTS = 4096;
+
+	// The baked length of the curve
+	real_t length = 0.0;
+
+	// The displacement from the start of the curve to its end. A repeating pattern moves by this much every lap
+	Vector2 start_to_end;
+
+	// Points evenly spaced along the curve by arc length, relative to the start of the curve
+	std::vector<Vector2> points;
+
+	// The amount of points per unit of arc length
+	real_t points_per_unit = 0.0;
+
+	// Returns the shared path for the curve, baking it if no bullets use the curve yet
+	static Ref<BulletMovementPatternPath2D> get_or_create(const Ref<Curve2D> &curve);
+
+	~BulletMovementPatternPath2D();
+
+	// The position (relative to the start of the curve) after travelling the given distance. The distance must be between 0 and length
+	_ALWAYS_INLINE_ Vector2 sample(real_t distance) const {
+		const real_t position = distance * points_per_unit;
+		const int index = static_cast<int>(position);
+		const int last_index = static_cast<int>(points.size()) - 1;
+
+		if (index >= last_index) {
+			return points[last_index];
+		}
+
+		return points[index].lerp(points[index + 1], position - index);
+	}
+
+	// The position (relative to the start of the curve) after travelling the given distance when the pattern repeats itself once the end of the curve is reached
+	_ALWAYS_INLINE_ Vector2 sample_repeating(real_t distance) const {
+		const int64_t laps = static_cast<int64_t>(distance / length);
+		return start_to_end * static_cast<real_t>(laps) + sample(distance - length * laps);
+	}
+
+protected:
+	static void _bind_methods() {}
+
+private:
+	Ref<Curve2D> curve;
+
+	void bake();
+};
+} //namespace BlastBullets2D
 
 using namespace godot;
 
 struct BulletMovementPatternData2D {
 	Ref<Curve2D> path_curve;
+	Ref<BlastBullets2D::BulletMovementPatternPath2D> path;
 	real_t distance_traveled = 0.0;
 	bool face_movement_direction = false;
 	bool repeat_pattern = true;
@@ -14,5 +77,5 @@ struct BulletMovementPatternData2D {
 	BulletMovementPatternData2D() = default;
 
 	BulletMovementPatternData2D(const Ref<Curve2D> &new_curve, bool new_face_movement_direction, bool new_repeat_pattern) :
-			path_curve(new_curve), distance_traveled(0.0), face_movement_direction(new_face_movement_direction), repeat_pattern(new_repeat_pattern) {}
+			path_curve(new_curve), path(BlastBullets2D::BulletMovementPatternPath2D::get_or_create(new_curve)), distance_traveled(0.0), face_movement_direction(new_face_movement_direction), repeat_pattern(new_repeat_pattern) {}
 };
@@ -0,0 +1,73 @@
+#include "./bullet_pattern_generator2d.hpp"
+
+#include "godot_cpp/core/math.hpp"
+
+using namespace godot;
+
+namespace BlastBullets2D {
+
+void BulletPatternGenerator2D::generate_ring(std::vector<Transform2D> &transforms, int amount_bullets, real_t radius, real_t start_angle_radians) {
+	transforms.resize(amount_bullets);
+
+	const real_t angle_step = Math_TAU / amount_bullets;
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		const real_t angle = start_angle_radians + angle_step * i;
+		transforms[i] = Transform2D(angle, Vector2(Math::cos(angle), Math::sin(angle)) * radius);
+	}
+}
+
+void BulletPatternGenerator2D::generate_arc(std::vector<Transform2D> &transforms, int amount_bullets, real_t radius, real_t spread_angle_radians, real_t center_angle_radians) {
+	transforms.resize(amount_bullets);
+
+	// A single bullet has no spread, so it goes straight through the center
+	const real_t angle_step = amount_bullets > 1 ? spread_angle_radians / (amount_bullets - 1) : 0.0;
+	const real_t start_angle = amount_bullets > 1 ? center_angle_radians - spread_angle_radians / 2 : center_angle_radians;
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		const real_t angle = start_angle + angle_step * i;
+		transforms[i] = Transform2D(angle, Vector2(Math::cos(angle), Math::sin(angle)) * radius);
+	}
+}
+
+void BulletPatternGenerator2D::generate_spiral(std::vector<Transform2D> &transforms, int amount_bullets, real_t start_radius, real_t radius_step, real_t angle_step_radians, real_t start_angle_radians) {
+	transforms.resize(amount_bullets);
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		const real_t angle = start_angle_radians + angle_step_radians * i;
+		const real_t radius = start_radius + radius_step * i;
+		transforms[i] = Transform2D(angle, Vector2(Math::cos(angle), Math::sin(angle)) * radius);
+	}
+}
+
+void BulletPatternGenerator2D::generate_spread(std::vector<Transform2D> &transforms, int amount_bullets, real_t spread_angle_radians) {
+	generate_arc(transforms, amount_bullets, 0.0, spread_angle_radians, 0.0);
+}
+
+void BulletPatternGenerator2D::generate_line(std::vector<Transform2D> &transforms, int amount_bullets, real_t length) {
+	transforms.resize(amount_bullets);
+
+	const real_t spacing = amount_bullets > 1 ? length / (amount_bullets - 1) : 0.0;
+	const real_t start_y = amount_bullets > 1 ? -length / 2 : 0.0;
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		transforms[i] = Transform2D(0.0, Vector2(0, start_y + spacing * i));
+	}
+}
+
+void BulletPatternGenerator2D::generate_path(std::vector<Transform2D> &transforms, int amount_bullets, const Ref<Curve2D> &curve, bool rotate_with_path) {
+	transforms.resize(amount_bullets);
+
+	const real_t length = curve->get_baked_length();
+	const real_t spacing = amount_bullets > 1 ? length / (amount_bullets - 1) : 0.0;
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		if (rotate_with_path) {
+			transforms[i] = curve->sample_baked_with_rotation(spacing * i);
+		} else {
+			transforms[i] = Transform2D(0.0, curve->sample_baked(spacing * i));
+		}
+	}
+}
+
+} //namespace BlastBullets2D
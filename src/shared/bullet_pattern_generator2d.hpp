@@ -0,0 +1,33 @@
+#pragma once
+
+#include "godot_cpp/classes/curve2d.hpp"
+#include "godot_cpp/classes/ref.hpp"
+#include "godot_cpp/variant/transform2d.hpp"
+#include <vector>
+
+namespace BlastBullets2D {
+using namespace godot;
+
+// Generates the transforms of common bullet patterns straight into native memory (the compiled transforms of the spawn data), without building an array of Variants first.
+// All patterns are relative to (0, 0) and aim to the right (rotation 0), so that they can be placed and aimed by the spawn origin when spawning from a template. Every bullet faces the direction it is fired in
+class BulletPatternGenerator2D {
+public:
+	// Bullets evenly spaced on a full circle, facing outwards
+	static void generate_ring(std::vector<Transform2D> &transforms, int amount_bullets, real_t radius, real_t start_angle_radians);
+
+	// Bullets evenly spaced on a part of a circle centered around the center angle, facing outwards. The first and the last bullet are placed on the edges of the spread angle
+	static void generate_arc(std::vector<Transform2D> &transforms, int amount_bullets, real_t radius, real_t spread_angle_radians, real_t center_angle_radians);
+
+	// Each bullet is rotated by the angle step and pushed outwards by the radius step compared to the previous one
+	static void generate_spiral(std::vector<Transform2D> &transforms, int amount_bullets, real_t start_radius, real_t radius_step, real_t angle_step_radians, real_t start_angle_radians);
+
+	// An n-way shotgun - all bullets start at the same position and are evenly fanned out across the spread angle
+	static void generate_spread(std::vector<Transform2D> &transforms, int amount_bullets, real_t spread_angle_radians);
+
+	// Bullets evenly spaced on a line that is perpendicular to the direction they are fired in (a wall of bullets)
+	static void generate_line(std::vector<Transform2D> &transforms, int amount_bullets, real_t length);
+
+	// Bullets evenly spaced along the baked length of a curve. If rotate_with_path is true the bullets face the direction of the curve at their position, otherwise they all face to the right
+	static void generate_path(std::vector<Transform2D> &transforms, int amount_bullets, const Ref<Curve2D> &curve, bool rotate_with_path);
+};
+} //namespace BlastBullets2D
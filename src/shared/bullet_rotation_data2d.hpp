@@ -36,4 +36,11 @@ public:
 protected:
 	static void _bind_methods();
 };
+
+// The plain values of a BulletRotationData2D. Used by compiled spawn data, so spawning doesn't need to go through Variant/Object for every bullet
+struct CompiledBulletRotationData2D {
+	real_t rotation_speed = 0;
+	real_t max_rotation_speed = 0;
+	real_t rotation_acceleration = 0;
+};
 } //namespace BlastBullets2D
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "./bullet_shared_resources_cache2d.hpp"
+
+#include "godot_cpp/classes/physics_server2d.hpp"
+
+using namespace godot;
+
+namespace BlastBullets2D {
+
+BulletSharedResourcesCache2D::~BulletSharedResourcesCache2D() {
+	PhysicsServer2D *physics_server = PhysicsServer2D::get_singleton();
+
+	// The physics server might already be gone when the engine shuts down
+	if (physics_server == nullptr) {
+		return;
+	}
+
+	for (auto &[size, shared_shape] : rectangle_shapes) {
+		physics_server->free_rid(shared_shape.shape);
+	}
+}
+
+Ref<QuadMesh> BulletSharedResourcesCache2D::acquire_quad_mesh(const Vector2 &size) {
+	SharedQuadMesh &shared_mesh = quad_meshes[size];
+
+	if (shared_mesh.mesh.is_null()) {
+		shared_mesh.mesh.instantiate();
+		shared_mesh.mesh->set_size(size);
+	}
+
+	++shared_mesh.reference_count;
+
+	return shared_mesh.mesh;
+}
+
+void BulletSharedResourcesCache2D::release_quad_mesh(const Vector2 &size) {
+	auto it = quad_meshes.find(size);
+	if (it == quad_meshes.end()) {
+		return;
+	}
+
+	if (--it->second.reference_count <= 0) {
+		quad_meshes.erase(it);
+	}
+}
+
+RID BulletSharedResourcesCache2D::acquire_rectangle_shape(const Vector2 &size) {
+	SharedRectangleShape &shared_shape = rectangle_shapes[size];
+
+	if (!shared_shape.shape.is_valid()) {
+		PhysicsServer2D *physics_server = PhysicsServer2D::get_singleton();
+
+		shared_shape.shape = physics_server->rectangle_shape_create();
+		physics_server->shape_set_data(shared_shape.shape, size / 2); // SHAPE_RECTANGLE wants half extents
+	}
+
+	++shared_shape.reference_count;
+
+	return shared_shape.shape;
+}
+
+void BulletSharedResourcesCache2D::release_rectangle_shape(const Vector2 &size) {
+	auto it = rectangle_shapes.find(size);
+	if (it == rectangle_shapes.end()) {
+		return;
+	}
+
+	if (--it->second.reference_count <= 0) {
+		PhysicsServer2D::get_singleton()->free_rid(it->second.shape);
+		rectangle_shapes.erase(it);
+	}
+}
+
+int BulletSharedResourcesCache2D::get_quad_meshes_amount() const {
+	return static_cast<int>(quad_meshes.size());
+}
+
+int BulletSharedResourcesCache2D::get_rectangle_shapes_amount() const {
+	return static_cast<int>(rectangle_shapes.size());
+}
+
+} //namespace BlastBullets2D
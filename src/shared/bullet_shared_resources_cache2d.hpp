@@ -0,0 +1,44 @@
+#pragma once
+
+#include "godot_cpp/classes/quad_mesh.hpp"
+#include "godot_cpp/classes/ref.hpp"
+#include "godot_cpp/variant/rid.hpp"
+#include "godot_cpp/variant/vector2.hpp"
+#include <map>
+
+namespace BlastBullets2D {
+using namespace godot;
+
+// Holds the QuadMeshes and the rectangle collision shapes that bullet multimeshes use, so that every multimesh (and every bullet inside of it) with the same texture size/collision shape size shares a single one instead of creating its own.
+// Every acquire has to be matched with a release. A mesh/shape is freed when nothing uses it anymore
+class BulletSharedResourcesCache2D {
+public:
+	~BulletSharedResourcesCache2D();
+
+	// Returns the QuadMesh with that size, creating it if nothing uses it yet
+	Ref<QuadMesh> acquire_quad_mesh(const Vector2 &size);
+	void release_quad_mesh(const Vector2 &size);
+
+	// Returns the rectangle shape RID with that size (the full size, not the half extents), creating it if nothing uses it yet
+	RID acquire_rectangle_shape(const Vector2 &size);
+	void release_rectangle_shape(const Vector2 &size);
+
+	int get_quad_meshes_amount() const;
+	int get_rectangle_shapes_amount() const;
+
+private:
+	struct SharedQuadMesh {
+		Ref<QuadMesh> mesh;
+		int reference_count = 0;
+	};
+
+	struct SharedRectangleShape {
+		RID shape;
+		int reference_count = 0;
+	};
+
+	// Keyed by size
+	std::map<Vector2, SharedQuadMesh> quad_meshes;
+	std::map<Vector2, SharedRectangleShape> rectangle_shapes;
+};
+} //namespace BlastBullets2D
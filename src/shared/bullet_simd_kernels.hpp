@@ -0,0 +1,180 @@
+#pragma once
+
+#include "godot_cpp/core/defs.hpp"
+#include "godot_cpp/core/math.hpp"
+
+// The vectorized kernels are only used when real_t is a float. Double precision builds always use the scalar fallback
+#if !defined(REAL_T_IS_DOUBLE)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BLAST_BULLETS_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BLAST_BULLETS_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BLAST_BULLETS_SIMD_NEON
+#endif
+#endif
+
+namespace BlastBullets2D {
+using namespace godot;
+
+// Kernels for the most common bullet movement - moving in a straight line while accelerating and optionally rotating by a constant angle. They work on the structure-of-arrays state of BulletSoaState2D, where every value (x, y, speed, cos, sin..) has its own array, so every kernel is a plain loop of vertical operations without any shuffling. Each kernel has a scalar fallback that does exactly the same thing
+namespace BulletSimdKernels {
+
+// The arrays are aligned to this many bytes (the width of an AVX2 register)
+constexpr int ALIGNMENT = 32;
+
+// The arrays are padded to a multiple of this many values (the amount of floats in an AVX2 register), so the kernels only ever load and store whole registers. The amount passed to the kernels has to be a multiple of it
+constexpr int LANE_PADDING = 8;
+
+// Rounds the amount of values up to a multiple of LANE_PADDING
+_ALWAYS_INLINE_ int pad_amount(int amount) {
+	return (amount + LANE_PADDING - 1) & ~(LANE_PADDING - 1);
+}
+
+// values[i] += rates[i] * delta (moves the positions by the velocities)
+_ALWAYS_INLINE_ void integrate(real_t *values, const real_t *rates, real_t delta, int amount_padded) {
+	int i = 0;
+
+#if defined(BLAST_BULLETS_SIMD_AVX2)
+	const __m256 delta_vec = _mm256_set1_ps(delta);
+	for (; i < amount_padded; i += 8) {
+		__m256 v = _mm256_load_ps(values + i);
+		__m256 r = _mm256_load_ps(rates + i);
+		_mm256_store_ps(values + i, _mm256_add_ps(v, _mm256_mul_ps(r, delta_vec)));
+	}
+#elif defined(BLAST_BULLETS_SIMD_SSE2)
+	const __m128 delta_vec = _mm_set1_ps(delta);
+	for (; i < amount_padded; i += 4) {
+		__m128 v = _mm_load_ps(values + i);
+		__m128 r = _mm_load_ps(rates + i);
+		_mm_store_ps(values + i, _mm_add_ps(v, _mm_mul_ps(r, delta_vec)));
+	}
+#elif defined(BLAST_BULLETS_SIMD_NEON)
+	const float32x4_t delta_vec = vdupq_n_f32(delta);
+	for (; i < amount_padded; i += 4) {
+		float32x4_t v = vld1q_f32(values + i);
+		float32x4_t r = vld1q_f32(rates + i);
+		vst1q_f32(values + i, vmlaq_f32(v, r, delta_vec));
+	}
+#endif
+
+	// Scalar fallback
+	for (; i < amount_padded; ++i) {
+		values[i] += rates[i] * delta;
+	}
+}
+
+// speeds[i] = min(speeds[i] + accelerations[i] * delta, max_speeds[i])
+_ALWAYS_INLINE_ void accelerate_speeds(real_t *speeds, const real_t *accelerations, const real_t *max_speeds, real_t delta, int amount_padded) {
+	int i = 0;
+
+#if defined(BLAST_BULLETS_SIMD_AVX2)
+	const __m256 delta_vec = _mm256_set1_ps(delta);
+	for (; i < amount_padded; i += 8) {
+		__m256 s = _mm256_load_ps(speeds + i);
+		__m256 a = _mm256_load_ps(accelerations + i);
+		__m256 m = _mm256_load_ps(max_speeds + i);
+		_mm256_store_ps(speeds + i, _mm256_min_ps(_mm256_add_ps(s, _mm256_mul_ps(a, delta_vec)), m));
+	}
+#elif defined(BLAST_BULLETS_SIMD_SSE2)
+	const __m128 delta_vec = _mm_set1_ps(delta);
+	for (; i < amount_padded; i += 4) {
+		__m128 s = _mm_load_ps(speeds + i);
+		__m128 a = _mm_load_ps(accelerations + i);
+		__m128 m = _mm_load_ps(max_speeds + i);
+		_mm_store_ps(speeds + i, _mm_min_ps(_mm_add_ps(s, _mm_mul_ps(a, delta_vec)), m));
+	}
+#elif defined(BLAST_BULLETS_SIMD_NEON)
+	const float32x4_t delta_vec = vdupq_n_f32(delta);
+	for (; i < amount_padded; i += 4) {
+		float32x4_t s = vld1q_f32(speeds + i);
+		float32x4_t a = vld1q_f32(accelerations + i);
+		float32x4_t m = vld1q_f32(max_speeds + i);
+		vst1q_f32(speeds + i, vminq_f32(vmlaq_f32(s, a, delta_vec), m));
+	}
+#endif
+
+	for (; i < amount_padded; ++i) {
+		speeds[i] = Math::min(speeds[i] + accelerations[i] * delta, max_speeds[i]);
+	}
+}
+
+// velocities[i] = directions[i] * speeds[i] + velocity_offset, for a single axis (called once for x and once for y)
+_ALWAYS_INLINE_ void calculate_velocities(real_t *velocities, const real_t *directions, const real_t *speeds, real_t velocity_offset, int amount_padded) {
+	int i = 0;
+
+#if defined(BLAST_BULLETS_SIMD_AVX2)
+	const __m256 offset_vec = _mm256_set1_ps(velocity_offset);
+	for (; i < amount_padded; i += 8) {
+		__m256 d = _mm256_load_ps(directions + i);
+		__m256 s = _mm256_load_ps(speeds + i);
+		_mm256_store_ps(velocities + i, _mm256_add_ps(_mm256_mul_ps(d, s), offset_vec));
+	}
+#elif defined(BLAST_BULLETS_SIMD_SSE2)
+	const __m128 offset_vec = _mm_set1_ps(velocity_offset);
+	for (; i < amount_padded; i += 4) {
+		__m128 d = _mm_load_ps(directions + i);
+		__m128 s = _mm_load_ps(speeds + i);
+		_mm_store_ps(velocities + i, _mm_add_ps(_mm_mul_ps(d, s), offset_vec));
+	}
+#elif defined(BLAST_BULLETS_SIMD_NEON)
+	const float32x4_t offset_vec = vdupq_n_f32(velocity_offset);
+	for (; i < amount_padded; i += 4) {
+		float32x4_t d = vld1q_f32(directions + i);
+		float32x4_t s = vld1q_f32(speeds + i);
+		vst1q_f32(velocities + i, vmlaq_f32(offset_vec, d, s));
+	}
+#endif
+
+	for (; i < amount_padded; ++i) {
+		velocities[i] = directions[i] * speeds[i] + velocity_offset;
+	}
+}
+
+// Rotates every (xs[i], ys[i]) vector by the same angle. Used on the cos/sin arrays (columns[0] of the transforms) and on columns[1], so it's the same result as calling rotate_transform_locally on each transform, but the sine and cosine are calculated only once by the caller
+_ALWAYS_INLINE_ void rotate_vectors(real_t *xs, real_t *ys, real_t sin_angle, real_t cos_angle, int amount_padded) {
+	int i = 0;
+
+#if defined(BLAST_BULLETS_SIMD_AVX2)
+	const __m256 cos_vec = _mm256_set1_ps(cos_angle);
+	const __m256 sin_vec = _mm256_set1_ps(sin_angle);
+	for (; i < amount_padded; i += 8) {
+		__m256 x = _mm256_load_ps(xs + i);
+		__m256 y = _mm256_load_ps(ys + i);
+		_mm256_store_ps(xs + i, _mm256_sub_ps(_mm256_mul_ps(x, cos_vec), _mm256_mul_ps(y, sin_vec)));
+		_mm256_store_ps(ys + i, _mm256_add_ps(_mm256_mul_ps(x, sin_vec), _mm256_mul_ps(y, cos_vec)));
+	}
+#elif defined(BLAST_BULLETS_SIMD_SSE2)
+	const __m128 cos_vec = _mm_set1_ps(cos_angle);
+	const __m128 sin_vec = _mm_set1_ps(sin_angle);
+	for (; i < amount_padded; i += 4) {
+		__m128 x = _mm_load_ps(xs + i);
+		__m128 y = _mm_load_ps(ys + i);
+		_mm_store_ps(xs + i, _mm_sub_ps(_mm_mul_ps(x, cos_vec), _mm_mul_ps(y, sin_vec)));
+		_mm_store_ps(ys + i, _mm_add_ps(_mm_mul_ps(x, sin_vec), _mm_mul_ps(y, cos_vec)));
+	}
+#elif defined(BLAST_BULLETS_SIMD_NEON)
+	const float32x4_t cos_vec = vdupq_n_f32(cos_angle);
+	const float32x4_t sin_vec = vdupq_n_f32(sin_angle);
+	for (; i < amount_padded; i += 4) {
+		float32x4_t x = vld1q_f32(xs + i);
+		float32x4_t y = vld1q_f32(ys + i);
+		vst1q_f32(xs + i, vmlsq_f32(vmulq_f32(x, cos_vec), y, sin_vec));
+		vst1q_f32(ys + i, vmlaq_f32(vmulq_f32(y, cos_vec), x, sin_vec));
+	}
+#endif
+
+	for (; i < amount_padded; ++i) {
+		const real_t x = xs[i];
+		const real_t y = ys[i];
+
+		xs[i] = x * cos_angle - y * sin_angle;
+		ys[i] = x * sin_angle + y * cos_angle;
+	}
+}
+
+} //namespace BulletSimdKernels
+} //namespace BlastBullets2D
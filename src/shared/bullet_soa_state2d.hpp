@@ -0,0 +1,86 @@
+#pragma once
+
+#include "bullet_simd_kernels.hpp"
+
+#include "godot_cpp/core/defs.hpp"
+#include <cstring>
+#include <new>
+
+namespace BlastBullets2D {
+using namespace godot;
+
+// A structure-of-arrays copy of the straight-line movement state of the active bullets. Every value has its own array, aligned to BulletSimdKernels::ALIGNMENT and padded to BulletSimdKernels::LANE_PADDING, so the SIMD kernels work on whole registers only.
+// Slot k holds the bullet active_bullet_indexes[k]: it is gathered from the per-bullet vectors right before the kernels run and scattered back right after, so only the active bullets are processed and it never has to be kept in sync by the rest of the code
+class BulletSoaState2D {
+public:
+	// Global position (the origin of the instance transform)
+	real_t *x = nullptr;
+	real_t *y = nullptr;
+
+	real_t *velocity_x = nullptr;
+	real_t *velocity_y = nullptr;
+	real_t *direction_x = nullptr;
+	real_t *direction_y = nullptr;
+
+	real_t *speed = nullptr;
+	real_t *max_speed = nullptr;
+	real_t *acceleration = nullptr;
+
+	// columns[0] of the instance transform - the cos and sin of the rotation (multiplied by the x scale)
+	real_t *cos = nullptr;
+	real_t *sin = nullptr;
+
+	// columns[1] of the instance transform
+	real_t *y_axis_x = nullptr;
+	real_t *y_axis_y = nullptr;
+
+	BulletSoaState2D() = default;
+	BulletSoaState2D(const BulletSoaState2D &) = delete;
+	BulletSoaState2D &operator=(const BulletSoaState2D &) = delete;
+
+	~BulletSoaState2D() {
+		free_arrays();
+	}
+
+	// Makes sure every array can hold at least the given amount of bullets (plus the padding). Only ever grows, the old values are not kept. The padding is zeroed, so the kernels never do math on garbage
+	_ALWAYS_INLINE_ void reserve(int amount_bullets) {
+		const int new_capacity = BulletSimdKernels::pad_amount(amount_bullets);
+		if (new_capacity <= capacity) {
+			return;
+		}
+
+		free_arrays();
+
+		capacity = new_capacity;
+		data = static_cast<real_t *>(::operator new[](sizeof(real_t) * capacity * AMOUNT_ARRAYS, std::align_val_t(BulletSimdKernels::ALIGNMENT)));
+		std::memset(data, 0, sizeof(real_t) * capacity * AMOUNT_ARRAYS);
+
+		// capacity is a multiple of LANE_PADDING, so every array starts aligned as well
+		real_t **arrays[AMOUNT_ARRAYS] = { &x, &y, &velocity_x, &velocity_y, &direction_x, &direction_y, &speed, &max_speed, &acceleration, &cos, &sin, &y_axis_x, &y_axis_y };
+		for (int a = 0; a < AMOUNT_ARRAYS; ++a) {
+			*arrays[a] = data + static_cast<size_t>(capacity) * a;
+		}
+	}
+
+	_ALWAYS_INLINE_ int get_capacity() const {
+		return capacity;
+	}
+
+private:
+	static constexpr int AMOUNT_ARRAYS = 13;
+
+	// A single allocation holding all arrays one after another
+	real_t *data = nullptr;
+	int capacity = 0;
+
+	_ALWAYS_INLINE_ void free_arrays() {
+		if (data != nullptr) {
+			::operator delete[](data, std::align_val_t(BulletSimdKernels::ALIGNMENT));
+		}
+
+		data = nullptr;
+		capacity = 0;
+	}
+};
+
+} //namespace BlastBullets2D
@@ -36,4 +36,11 @@ public:
 protected:
 	static void _bind_methods();
 };
+
+// The plain values of a BulletSpeedData2D. Used by compiled spawn data, so spawning doesn't need to go through Variant/Object for every bullet
+struct CompiledBulletSpeedData2D {
+	real_t speed = 0;
+	real_t max_speed = 0;
+	real_t acceleration = 0;
+};
 } //namespace BlastBullets2D
@@ -0,0 +1,84 @@
+#include "./bullet_timer_scheduler2d.hpp"
+
+#include "../bullets/multimesh_bullets2d.hpp"
+#include "godot_cpp/core/object.hpp"
+#include "godot_cpp/variant/utility_functions.hpp"
+#include <algorithm>
+
+using namespace godot;
+
+namespace BlastBullets2D {
+
+void BulletTimerScheduler2D::schedule(MultiMeshBullets2D *multimesh, const Callable &callback, double time, bool repeat, bool execute_only_if_multimesh_is_active) {
+	// A repeating timer with no interval would be due again right away
+	if (time <= 0.0) {
+		UtilityFunctions::push_error("Error when trying to schedule a time based function. The time has to be above 0. Ignoring the request");
+		return;
+	}
+
+	Timer timer;
+	timer.due_time = elapsed_time + time;
+	timer.interval = time;
+	timer.multimesh_instance_id = multimesh->get_instance_id();
+	timer.multimesh_timers_generation = multimesh->get_timers_generation();
+	timer.callback = callback;
+	timer.repeat = repeat;
+	timer.execute_only_if_multimesh_is_active = execute_only_if_multimesh_is_active;
+
+	timers.emplace_back(timer);
+	std::push_heap(timers.begin(), timers.end(), IsDueLater());
+}
+
+void BulletTimerScheduler2D::cancel(uint64_t multimesh_instance_id, const Callable &callback) {
+	// The timers stay inside the heap and get dropped once they are due, so the order of the heap is never touched
+	for (Timer &timer : timers) {
+		if (timer.multimesh_instance_id == multimesh_instance_id && timer.callback == callback) {
+			timer.is_cancelled = true;
+		}
+	}
+}
+
+void BulletTimerScheduler2D::clear() {
+	timers.clear();
+	due_timers.clear();
+	elapsed_time = 0.0;
+}
+
+int BulletTimerScheduler2D::get_timers_amount() const {
+	return static_cast<int>(timers.size());
+}
+
+void BulletTimerScheduler2D::run_due_timers() {
+	// Take every due timer out of the heap first. Repeating timers are pushed back only after all of them ran, so they can't become due again in the same advance (which would spin forever once elapsed_time + interval rounds to elapsed_time)
+	due_timers.clear();
+
+	while (!timers.empty() && timers.front().due_time <= elapsed_time) {
+		std::pop_heap(timers.begin(), timers.end(), IsDueLater());
+		due_timers.emplace_back(std::move(timers.back()));
+		timers.pop_back();
+	}
+
+	for (Timer &timer : due_timers) {
+		MultiMeshBullets2D *multimesh = Object::cast_to<MultiMeshBullets2D>(ObjectDB::get_instance(timer.multimesh_instance_id));
+
+		if (timer.is_cancelled || multimesh == nullptr || multimesh->get_timers_generation() != timer.multimesh_timers_generation) {
+			continue;
+		}
+
+		// Deferred, so the callback can't touch the timers while we are iterating them
+		multimesh->execute_stored_callable_safely(timer.callback, timer.execute_only_if_multimesh_is_active);
+
+		if (!timer.repeat) {
+			continue;
+		}
+
+		// A repeating timer starts counting again from the frame it fired in
+		timer.due_time = elapsed_time + timer.interval;
+		timers.emplace_back(std::move(timer));
+		std::push_heap(timers.begin(), timers.end(), IsDueLater());
+	}
+
+	due_timers.clear();
+}
+
+} //namespace BlastBullets2D
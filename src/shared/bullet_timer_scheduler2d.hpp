@@ -0,0 +1,71 @@
+#pragma once
+
+#include "godot_cpp/core/defs.hpp"
+#include "godot_cpp/variant/callable.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace BlastBullets2D {
+using namespace godot;
+
+class MultiMeshBullets2D;
+
+// Runs the time based functions of all bullet multimeshes (multimesh_attach_time_based_function). The timers are kept in a single min-heap ordered by the time they are due, so a physics frame in which no timer is due costs a single comparison no matter how many multimeshes or timers exist.
+// Timers of multimeshes that were freed or detached all of their timers (which happens when they get pooled) are dropped once they come up
+class BulletTimerScheduler2D {
+public:
+	// The time has to be above 0, otherwise the request is ignored
+	void schedule(MultiMeshBullets2D *multimesh, const Callable &callback, double time, bool repeat, bool execute_only_if_multimesh_is_active);
+
+	// Stops all timers of the multimesh that run the callback
+	void cancel(uint64_t multimesh_instance_id, const Callable &callback);
+
+	// Advances the time and runs every timer that is due. Each timer runs at most once per advance, even if its interval is shorter than the delta
+	_ALWAYS_INLINE_ void advance(double delta) {
+		elapsed_time += delta;
+
+		if (timers.empty() || timers.front().due_time > elapsed_time) {
+			return;
+		}
+
+		run_due_timers();
+	}
+
+	void clear();
+
+	// Includes timers that were stopped but haven't been dropped yet
+	int get_timers_amount() const;
+
+private:
+	struct Timer {
+		double due_time = 0.0;
+		double interval = 0.0;
+
+		uint64_t multimesh_instance_id = 0;
+
+		// The timers generation of the multimesh at the time the timer was attached. Once the multimesh detaches all of its timers it no longer matches
+		uint32_t multimesh_timers_generation = 0;
+
+		Callable callback;
+		bool repeat = false;
+		bool execute_only_if_multimesh_is_active = true;
+		bool is_cancelled = false;
+	};
+
+	// Orders the heap so that the timer that is due first is at the front
+	struct IsDueLater {
+		_ALWAYS_INLINE_ bool operator()(const Timer &a, const Timer &b) const {
+			return a.due_time > b.due_time;
+		}
+	};
+
+	std::vector<Timer> timers;
+
+	// The timers that are due in the current advance. Kept as a member so it doesn't allocate every time
+	std::vector<Timer> due_timers;
+
+	double elapsed_time = 0.0;
+
+	void run_due_timers();
+};
+} //namespace BlastBullets2D
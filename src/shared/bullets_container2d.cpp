@@ -0,0 +1,103 @@
+#include "./bullets_container2d.hpp"
+#include "../bullets/multimesh_bullets2d.hpp"
+#include "../debugger/multimesh_bullets_debugger2d.hpp"
+
+#include "godot_cpp/classes/rendering_server.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+using namespace godot;
+
+namespace BlastBullets2D {
+
+BulletsContainer2D::~BulletsContainer2D() {
+	RenderingServer *rendering_server = RenderingServer::get_singleton();
+
+	// The rendering server might already be gone when the engine shuts down
+	if (rendering_server == nullptr || !canvas_item.is_valid()) {
+		return;
+	}
+
+	rendering_server->free_rid(canvas_item);
+}
+
+void BulletsContainer2D::create(const RID &canvas) {
+	RenderingServer *rendering_server = RenderingServer::get_singleton();
+
+	canvas_item = rendering_server->canvas_item_create();
+	rendering_server->canvas_item_set_parent(canvas_item, canvas);
+}
+
+void BulletsContainer2D::add_multimesh(MultiMeshBullets2D &multimesh) {
+	multimesh.bullets_container_index = static_cast<int>(multimeshes.size());
+	multimeshes.push_back(&multimesh);
+
+	RenderingServer::get_singleton()->canvas_item_set_parent(multimesh.canvas_item, canvas_item);
+	move_to_front(multimesh);
+
+	if (debugger != nullptr) {
+		debugger->add_debugger_data_provider(&multimesh);
+	}
+}
+
+void BulletsContainer2D::remove_multimesh(MultiMeshBullets2D &multimesh) {
+	const int index = multimesh.bullets_container_index;
+	if (index < 0 || index >= static_cast<int>(multimeshes.size()) || multimeshes[index] != &multimesh) {
+		return;
+	}
+
+	MultiMeshBullets2D *last_multimesh = multimeshes.back();
+	multimeshes[index] = last_multimesh;
+	last_multimesh->bullets_container_index = index;
+	multimeshes.pop_back();
+
+	multimesh.bullets_container_index = -1;
+}
+
+void BulletsContainer2D::move_to_front(MultiMeshBullets2D &multimesh) {
+	// Already drawn on top of everything else
+	if (multimesh.draw_index == next_draw_index - 1 && next_draw_index > 0) {
+		return;
+	}
+
+	if (next_draw_index == std::numeric_limits<int32_t>::max()) {
+		compact_draw_indexes();
+	}
+
+	multimesh.draw_index = next_draw_index++;
+	RenderingServer::get_singleton()->canvas_item_set_draw_index(multimesh.canvas_item, multimesh.draw_index);
+}
+
+void BulletsContainer2D::set_debugger(MultiMeshBulletsDebugger2D *new_debugger) {
+	debugger = new_debugger;
+}
+
+void BulletsContainer2D::get_debugger_data_providers(std::vector<IDebuggerDataProvider2D *> &providers) const {
+	providers.reserve(providers.size() + multimeshes.size());
+
+	for (MultiMeshBullets2D *multimesh : multimeshes) {
+		providers.push_back(multimesh);
+	}
+}
+
+int BulletsContainer2D::get_amount_multimeshes() const {
+	return static_cast<int>(multimeshes.size());
+}
+
+void BulletsContainer2D::compact_draw_indexes() {
+	std::vector<MultiMeshBullets2D *> sorted_multimeshes = multimeshes;
+	std::sort(sorted_multimeshes.begin(), sorted_multimeshes.end(), [](const MultiMeshBullets2D *a, const MultiMeshBullets2D *b) {
+		return a->draw_index < b->draw_index;
+	});
+
+	RenderingServer *rendering_server = RenderingServer::get_singleton();
+
+	next_draw_index = 0;
+	for (MultiMeshBullets2D *multimesh : sorted_multimeshes) {
+		multimesh->draw_index = next_draw_index++;
+		rendering_server->canvas_item_set_draw_index(multimesh->canvas_item, multimesh->draw_index);
+	}
+}
+
+} //namespace BlastBullets2D
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "godot_cpp/variant/rid.hpp"
+#include <vector>
+
+namespace BlastBullets2D {
+using namespace godot;
+
+class IDebuggerDataProvider2D;
+class MultiMeshBullets2D;
+class MultiMeshBulletsDebugger2D;
+
+// Holds all bullet multimeshes of a single bullet type without them being nodes. Every multimesh draws through its own canvas item that is a child of the canvas item of the container, so spawning, pooling and re-ordering multimeshes never goes through the SceneTree.
+// The multimeshes are owned by the factory, the container only keeps track of them, so it has to outlive every multimesh that was added to it
+class BulletsContainer2D {
+public:
+	~BulletsContainer2D();
+
+	// Creates the canvas item of the container and draws it directly on the canvas (the multimeshes use global coordinates, same as when they were children of a plain Node)
+	void create(const RID &canvas);
+
+	// Adds the multimesh to the container and draws its canvas item on top of all other multimeshes in the container. Tells the debugger about the multimesh as well
+	void add_multimesh(MultiMeshBullets2D &multimesh);
+
+	// Removes the multimesh from the container. Does not free anything
+	void remove_multimesh(MultiMeshBullets2D &multimesh);
+
+	// Draws the multimesh on top of all other multimeshes in the container (same as move_to_front(), but only a single rendering server call instead of re-ordering the nodes)
+	void move_to_front(MultiMeshBullets2D &multimesh);
+
+	// The debugger that gets told about every multimesh that gets added to the container
+	void set_debugger(MultiMeshBulletsDebugger2D *new_debugger);
+
+	// Collects every multimesh that was added to the container
+	void get_debugger_data_providers(std::vector<IDebuggerDataProvider2D *> &providers) const;
+
+	int get_amount_multimeshes() const;
+
+private:
+	RID canvas_item;
+
+	// Every multimesh knows its own index in here, so removing one is a swap and pop
+	std::vector<MultiMeshBullets2D *> multimeshes;
+
+	// The draw index that the next multimesh moved to the front gets. Canvas items with a bigger draw index are drawn on top
+	int next_draw_index = 0;
+
+	MultiMeshBulletsDebugger2D *debugger = nullptr;
+
+	// Renumbers the draw indexes of all multimeshes from 0 while keeping their order. Only needed once the draw indexes run out
+	void compact_draw_indexes();
+};
+} //namespace BlastBullets2D
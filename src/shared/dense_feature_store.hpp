@@ -0,0 +1,104 @@
+#pragma once
+
+#include "godot_cpp/core/defs.hpp"
+#include <utility>
+#include <vector>
+
+// Stores data for an optional per-bullet feature (per-bullet curves, movement patterns..) that usually only some of the bullets use.
+// The data is packed inside a compact slots vector and every bullet only keeps the index of its slot (-1 if the bullet doesn't use the feature), so a lookup is a single array read without any hashing
+template <typename TData>
+class DenseFeatureStore {
+private:
+	// For every bullet index - the index of the slot holding its data or -1 if the bullet doesn't have data
+	std::vector<int> slot_of_bullet;
+
+	// Contains ONLY the data of bullets that use the feature - packed for cache-friendly looping
+	std::vector<TData> slots;
+
+	// For every slot - the bullet index that owns it. Used for O(1) removal from the slots vector
+	std::vector<int> slot_owners;
+
+public:
+	// Resizes the store so it can hold data for the given amount of bullets. Existing data for bullet indexes that no longer fit is removed
+	_ALWAYS_INLINE_ void resize(int amount_bullets) {
+		for (int bullet_index = static_cast<int>(slot_of_bullet.size()) - 1; bullet_index >= amount_bullets; --bullet_index) {
+			erase(bullet_index);
+		}
+
+		slot_of_bullet.resize(amount_bullets, -1);
+	}
+
+	// Whether the bullet has data. Safe to call with any bullet index
+	_ALWAYS_INLINE_ bool contains(int bullet_index) const {
+		return bullet_index >= 0 && bullet_index < static_cast<int>(slot_of_bullet.size()) && slot_of_bullet[bullet_index] != -1;
+	}
+
+	// Returns a pointer to the bullet's data or nullptr if the bullet doesn't have data. The bullet index must be valid. The pointer is invalidated by set/erase calls
+	_ALWAYS_INLINE_ TData *find(int bullet_index) {
+		const int slot = slot_of_bullet[bullet_index];
+		return slot == -1 ? nullptr : &slots[slot];
+	}
+
+	_ALWAYS_INLINE_ const TData *find(int bullet_index) const {
+		const int slot = slot_of_bullet[bullet_index];
+		return slot == -1 ? nullptr : &slots[slot];
+	}
+
+	// Sets the data of a bullet, replacing the old data if there was any. The bullet index must be valid
+	_ALWAYS_INLINE_ TData &set(int bullet_index, const TData &data) {
+		const int slot = slot_of_bullet[bullet_index];
+
+		if (slot != -1) {
+			slots[slot] = data;
+			return slots[slot];
+		}
+
+		slots.push_back(data);
+		slot_owners.push_back(bullet_index);
+		slot_of_bullet[bullet_index] = static_cast<int>(slots.size()) - 1;
+
+		return slots.back();
+	}
+
+	// Removes the data of a bullet if it has any. Safe to call with any bullet index
+	_ALWAYS_INLINE_ void erase(int bullet_index) {
+		if (!contains(bullet_index)) {
+			return;
+		}
+
+		const int slot = slot_of_bullet[bullet_index];
+		const int last_slot = static_cast<int>(slots.size()) - 1;
+
+		// Move the last slot in place of the removed one so the slots stay packed
+		if (slot != last_slot) {
+			const int last_owner = slot_owners[last_slot];
+
+			slots[slot] = std::move(slots[last_slot]);
+			slot_owners[slot] = last_owner;
+			slot_of_bullet[last_owner] = slot;
+		}
+
+		slots.pop_back();
+		slot_owners.pop_back();
+		slot_of_bullet[bullet_index] = -1;
+	}
+
+	// Removes the data of all bullets. The store keeps its size so it can be reused
+	_ALWAYS_INLINE_ void clear() {
+		for (int owner : slot_owners) {
+			slot_of_bullet[owner] = -1;
+		}
+
+		slots.clear();
+		slot_owners.clear();
+	}
+
+	_ALWAYS_INLINE_ bool empty() const {
+		return slots.empty();
+	}
+
+	// The amount of bullets that have data
+	_ALWAYS_INLINE_ int size() const {
+		return static_cast<int>(slots.size());
+	}
+};
@@ -2,13 +2,16 @@
 #include "../bullets/multimesh_bullets2d.hpp"
 
 #include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/time.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <algorithm>
 
 using namespace godot;
 
 namespace BlastBullets2D {
 
 void MultiMeshObjectPool::push(MultiMeshBullets2D *multimesh, int amount_bullets) {
+	multimesh->pooled_since_msec = Time::get_singleton()->get_ticks_msec();
 	pool[amount_bullets].push_back(multimesh);
 }
 
@@ -27,6 +30,58 @@ MultiMeshBullets2D *MultiMeshObjectPool::pop(int amount_bullets) {
 	return found_multimesh;
 }
 
+MultiMeshBullets2D *MultiMeshObjectPool::pop_any() {
+	for (auto &[key, vec] : pool) {
+		if (vec.empty()) {
+			continue;
+		}
+
+		MultiMeshBullets2D *found_multimesh = vec.back();
+		vec.pop_back();
+
+		return found_multimesh;
+	}
+
+	return nullptr;
+}
+
+void MultiMeshObjectPool::set_size_classes(bool enable, const std::vector<int> &new_size_class_ladder) {
+	use_size_classes = enable;
+
+	size_class_ladder.clear();
+	for (int size_class : new_size_class_ladder) {
+		if (size_class > 0) {
+			size_class_ladder.push_back(size_class);
+		}
+	}
+
+	std::sort(size_class_ladder.begin(), size_class_ladder.end());
+	size_class_ladder.erase(std::unique(size_class_ladder.begin(), size_class_ladder.end()), size_class_ladder.end());
+}
+
+int MultiMeshObjectPool::get_size_class(int amount_bullets) const {
+	if (!use_size_classes || amount_bullets <= 0) {
+		return amount_bullets;
+	}
+
+	if (size_class_ladder.empty()) {
+		int size_class = 1;
+		while (size_class < amount_bullets) {
+			size_class <<= 1;
+		}
+		return size_class;
+	}
+
+	auto it = std::lower_bound(size_class_ladder.begin(), size_class_ladder.end(), amount_bullets);
+
+	// Bigger than the biggest size class, so there is nothing to round up to
+	if (it == size_class_ladder.end()) {
+		return amount_bullets;
+	}
+
+	return *it;
+}
+
 void MultiMeshObjectPool::clear() {
 	pool.clear();
 }
@@ -81,6 +136,31 @@ std::map<int, int> MultiMeshObjectPool::get_pool_info() {
 	return result;
 }
 
+int MultiMeshObjectPool::get_amount_pooled(int amount_bullets) const {
+	auto it = pool.find(amount_bullets);
+	if (it == pool.end()) {
+		return 0;
+	}
+
+	return static_cast<int>(it->second.size());
+}
+
+MultiMeshBullets2D *MultiMeshObjectPool::find_idle(int amount_bullets, uint64_t pooled_before_msec) const {
+	auto it = pool.find(amount_bullets);
+	if (it == pool.end()) {
+		return nullptr;
+	}
+
+	// pop() takes from the back, so the multimeshes at the front are usually the ones that have been waiting the longest
+	for (MultiMeshBullets2D *bullet_multi : it->second) {
+		if (bullet_multi->pooled_since_msec < pooled_before_msec) {
+			return bullet_multi;
+		}
+	}
+
+	return nullptr;
+}
+
 bool MultiMeshObjectPool::try_remove_instance(MultiMeshBullets2D *target, int amount_bullets) {
 	auto it = pool.find(amount_bullets);
 	if (it == pool.end()) {
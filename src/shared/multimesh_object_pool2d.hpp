@@ -5,6 +5,7 @@
 #include <godot_cpp/core/class_db.hpp>
 #include <queue>
 #include <unordered_map>
+#include <vector>
 
 #include <map>
 
@@ -15,12 +16,21 @@ class MultiMeshBullets2D;
 
 class MultiMeshObjectPool {
 public:
-	// Used to push a multimesh instance pointer inside the object pool. It's very important to pass amount_bullets value that is equal to the amount of bullet instances the multimesh has, otherwise program will crash
+	// Used to push a multimesh instance pointer inside the object pool. It's very important to pass amount_bullets value that is equal to the bullets capacity of the multimesh (the amount of bullet instances and collision shapes it has allocated), otherwise program will crash
 	void push(MultiMeshBullets2D *multimesh, int amount_bullets);
 
-	// Used to retrieve a multimesh that has exactly that many bullets. Basically the method will give you a pointer to a multimesh with N amount of bullets that were already spawned in the world but currently invisible and disabled in the pool. In case no multimesh instance has been found, it will return nullptr
+	// Used to retrieve a multimesh that has exactly that bullets capacity. Basically the method will give you a pointer to a multimesh with N amount of bullets that were already spawned in the world but currently invisible and disabled in the pool. In case no multimesh instance has been found, it will return nullptr
 	MultiMeshBullets2D *pop(int amount_bullets);
 
+	// Same as pop, but the multimesh can have any bullets capacity. Returns nullptr if the pool is empty
+	MultiMeshBullets2D *pop_any();
+
+	// Enables/disables size classes. When enabled multimeshes are allocated with the capacity of the size class that fits the requested amount of bullets, so a single pooled multimesh can be re-used for every spawn with a similar amount of bullets (only the first N bullets get enabled). An empty ladder means power of two size classes, otherwise the ladder holds the allowed capacities
+	void set_size_classes(bool enable, const std::vector<int> &new_size_class_ladder);
+
+	// Returns the bullets capacity that a multimesh with that many bullets should be allocated with (and popped from the pool with)
+	int get_size_class(int amount_bullets) const;
+
 	// Used to clear all bullet pointers that were saved inside the object pool. Note that this only clears the pointers and doesn't free the actual bullet multimesh objects.
 	void clear();
 
@@ -38,8 +48,19 @@ public:
 
 	bool try_remove_instance(MultiMeshBullets2D *target, int amount_bullets);
 
+	// Gets the amount of multimeshes in the pool that have exactly that bullets capacity
+	int get_amount_pooled(int amount_bullets) const;
+
+	// Finds a pooled multimesh with that bullets capacity that was pushed before the given time (Time::get_ticks_msec). Returns nullptr if every such multimesh was used more recently
+	MultiMeshBullets2D *find_idle(int amount_bullets, uint64_t pooled_before_msec) const;
+
 private:
 	// The key corresponds to the amount of bullets a bullets multimesh has, meanwhile the value corresponds to a queue that holds all of those that have that amount of bullets. Example: If key is 5, that means it holds all deenabled multimesh instances that each have 5 bullets (5 collision shapes, 5 texture instances that are currently invisible)
 	std::unordered_map<int, std::vector<MultiMeshBullets2D *>> pool;
+
+	bool use_size_classes = false;
+
+	// Sorted, without duplicates
+	std::vector<int> size_class_ladder;
 };
 } //namespace BlastBullets2D
@@ -1,5 +1,7 @@
 #include "block_bullets_data2d.hpp"
 
+#include "godot_cpp/variant/utility_functions.hpp"
+
 using namespace godot;
 
 namespace BlastBullets2D {
@@ -16,6 +18,29 @@ Ref<BulletSpeedData2D> BlockBulletsData2D::get_block_speed() const {
 }
 void BlockBulletsData2D::set_block_speed(const Ref<BulletSpeedData2D> &new_block_speed) {
 	block_speed = new_block_speed;
+	is_compiled = false;
+}
+
+bool BlockBulletsData2D::get_use_rigid_block_movement() const {
+	return use_rigid_block_movement;
+}
+void BlockBulletsData2D::set_use_rigid_block_movement(bool value) {
+	use_rigid_block_movement = value;
+}
+
+bool BlockBulletsData2D::compile_bullet_data() {
+	if (!MultiMeshBulletsData2D::compile_bullet_data()) {
+		return false;
+	}
+
+	if (block_speed.is_null()) {
+		UtilityFunctions::push_error("Error when trying to compile the spawn data. No block_speed was provided. Ignoring the request");
+		return false;
+	}
+
+	compiled_block_speed = CompiledBulletSpeedData2D{ block_speed->speed, block_speed->max_speed, block_speed->acceleration };
+
+	return true;
 }
 
 void BlockBulletsData2D::_bind_methods() {
@@ -26,5 +51,9 @@ void BlockBulletsData2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_block_speed"), &BlockBulletsData2D::get_block_speed);
 	ClassDB::bind_method(D_METHOD("set_block_speed", "new_block_speed"), &BlockBulletsData2D::set_block_speed);
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "block_speed"), "set_block_speed", "get_block_speed");
+
+	ClassDB::bind_method(D_METHOD("get_use_rigid_block_movement"), &BlockBulletsData2D::get_use_rigid_block_movement);
+	ClassDB::bind_method(D_METHOD("set_use_rigid_block_movement", "value"), &BlockBulletsData2D::set_use_rigid_block_movement);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_rigid_block_movement"), "set_use_rigid_block_movement", "get_use_rigid_block_movement");
 }
 } //namespace BlastBullets2D
\ No newline at end of file
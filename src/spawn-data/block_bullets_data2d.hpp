@@ -20,13 +20,24 @@ public:
 	// The speed at which the block of bullets is moving
 	Ref<BulletSpeedData2D> block_speed;
 
+	// If set to true, the whole block is moved as a single unit by moving its area and node, instead of updating every bullet's collision shape and instance every physics frame. Ignored when rotation data is provided
+	bool use_rigid_block_movement = false;
+
 	real_t get_block_rotation_radians() const;
 	void set_block_rotation_radians(real_t new_block_rotation_radians);
 
 	Ref<BulletSpeedData2D> get_block_speed() const;
 	void set_block_speed(const Ref<BulletSpeedData2D> &new_block_speed);
 
+	bool get_use_rigid_block_movement() const;
+	void set_use_rigid_block_movement(bool value);
+
+	// Filled by compile()
+	CompiledBulletSpeedData2D compiled_block_speed;
+
 protected:
 	static void _bind_methods();
+
+	virtual bool compile_bullet_data() override;
 };
 } //namespace BlastBullets2D
@@ -1,5 +1,6 @@
 #include "./directional_bullets_data2d.hpp"
 #include "godot_cpp/core/class_db.hpp"
+#include "godot_cpp/variant/utility_functions.hpp"
 
 using namespace godot;
 
@@ -10,6 +11,7 @@ TypedArray<BulletSpeedData2D> DirectionalBulletsData2D::get_all_bullet_speed_dat
 }
 void DirectionalBulletsData2D::set_all_bullet_speed_data(const TypedArray<BulletSpeedData2D> &new_data) {
 	all_bullet_speed_data = new_data;
+	is_compiled = false;
 }
 
 bool DirectionalBulletsData2D::get_adjust_direction_based_on_rotation() const {
@@ -20,6 +22,48 @@ void DirectionalBulletsData2D::set_adjust_direction_based_on_rotation(bool new_a
 	adjust_direction_based_on_rotation = new_adjust_direction_based_on_rotation;
 }
 
+bool DirectionalBulletsData2D::compile_bullet_data() {
+	if (!MultiMeshBulletsData2D::compile_bullet_data()) {
+		return false;
+	}
+
+	// Same rules as when spawning - either one speed data per bullet or only the first one is used for all bullets (no speed data at all means the bullets don't move)
+	const int amount_bullets = static_cast<int>(compiled_transforms.size());
+	const int amount_speed_data = all_bullet_speed_data.size();
+	const int amount_compiled_speed_data = amount_speed_data == amount_bullets ? amount_bullets : 1;
+
+	compiled_speed_data.assign(amount_compiled_speed_data, CompiledBulletSpeedData2D());
+
+	for (int i = 0; i < amount_compiled_speed_data && i < amount_speed_data; ++i) {
+		const BulletSpeedData2D *speed_data = Object::cast_to<BulletSpeedData2D>(all_bullet_speed_data[i]);
+		if (speed_data == nullptr) {
+			UtilityFunctions::push_error("Error when trying to compile the spawn data. The BulletSpeedData2D at index ", i, " is null. Ignoring the request");
+			return false;
+		}
+
+		compiled_speed_data[i] = CompiledBulletSpeedData2D{ speed_data->speed, speed_data->max_speed, speed_data->acceleration };
+	}
+
+	return true;
+}
+
+bool DirectionalBulletsData2D::compile_speed_ramp(real_t start_speed, real_t end_speed, real_t max_speed, real_t acceleration) {
+	if (!is_compiled) {
+		UtilityFunctions::push_error("Error when trying to compile a speed ramp. The spawn data has to be compiled first. Ignoring the request");
+		return false;
+	}
+
+	const int amount_bullets = static_cast<int>(compiled_transforms.size());
+	compiled_speed_data.resize(amount_bullets);
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		const real_t speed = Math::lerp(start_speed, end_speed, get_ramp_weight(i, amount_bullets));
+		compiled_speed_data[i] = CompiledBulletSpeedData2D{ speed, max_speed, acceleration };
+	}
+
+	return true;
+}
+
 void DirectionalBulletsData2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_all_bullet_speed_data"), &DirectionalBulletsData2D::get_all_bullet_speed_data);
 	ClassDB::bind_method(D_METHOD("set_all_bullet_speed_data", "new_data"), &DirectionalBulletsData2D::set_all_bullet_speed_data);
@@ -28,5 +72,7 @@ void DirectionalBulletsData2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_adjust_direction_based_on_rotation"), &DirectionalBulletsData2D::get_adjust_direction_based_on_rotation);
 	ClassDB::bind_method(D_METHOD("set_adjust_direction_based_on_rotation", "new_adjust_direction_based_on_rotation"), &DirectionalBulletsData2D::set_adjust_direction_based_on_rotation);
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "adjust_direction_based_on_rotation"), "set_adjust_direction_based_on_rotation", "get_adjust_direction_based_on_rotation");
+
+	ClassDB::bind_method(D_METHOD("compile_speed_ramp", "start_speed", "end_speed", "max_speed", "acceleration"), &DirectionalBulletsData2D::compile_speed_ramp);
 }
 } //namespace BlastBullets2D
@@ -21,7 +21,16 @@ public:
 
 	bool get_adjust_direction_based_on_rotation() const;
 	void set_adjust_direction_based_on_rotation(bool new_adjust_direction_based_on_rotation);
+
+	// Filled by compile(). Either a single entry shared by all bullets or one entry per bullet
+	std::vector<CompiledBulletSpeedData2D> compiled_speed_data;
+
+	// Overrides the compiled speed data with one entry per bullet, where the speed goes from the start value (first bullet) to the end value (last bullet). Call after compiling, any later compile call replaces it
+	bool compile_speed_ramp(real_t start_speed, real_t end_speed, real_t max_speed, real_t acceleration);
+
 protected:
 	static void _bind_methods();
+
+	virtual bool compile_bullet_data() override;
 };
 } //namespace BlastBullets2D
@@ -1,5 +1,7 @@
 #include "./multimesh_bullets_data2d.hpp"
+#include "../shared/bullet_pattern_generator2d.hpp"
 #include "godot_cpp/core/class_db.hpp"
+#include "godot_cpp/variant/utility_functions.hpp"
 
 using namespace godot;
 
@@ -15,11 +17,146 @@ int MultiMeshBulletsData2D::calculate_bitmask(const TypedArray<int> &numbers) {
 	return bitmask_value;
 }
 
+bool MultiMeshBulletsData2D::compile() {
+	is_compiled = false;
+
+	const int amount_bullets = transforms.size();
+	if (amount_bullets == 0) {
+		UtilityFunctions::push_error("Error when trying to compile the spawn data. No transforms were provided. Ignoring the request");
+		return false;
+	}
+
+	compiled_transforms.resize(amount_bullets);
+	for (int i = 0; i < amount_bullets; ++i) {
+		compiled_transforms[i] = transforms[i];
+	}
+
+	return finish_compile();
+}
+
+bool MultiMeshBulletsData2D::finish_compile() {
+	is_compiled = compile_bullet_data();
+	return is_compiled;
+}
+
+bool MultiMeshBulletsData2D::compile_bullet_data() {
+	const int amount_bullets = static_cast<int>(compiled_transforms.size());
+
+	// Same rules as when spawning - either one rotation data per bullet or only the first one is used for all bullets
+	const int amount_rotation_data = all_bullet_rotation_data.size();
+	const int amount_compiled_rotation_data = amount_rotation_data == 0 ? 0 : (amount_rotation_data == amount_bullets ? amount_bullets : 1);
+
+	compiled_rotation_data.resize(amount_compiled_rotation_data);
+	for (int i = 0; i < amount_compiled_rotation_data; ++i) {
+		const BulletRotationData2D *rotation_data = Object::cast_to<BulletRotationData2D>(all_bullet_rotation_data[i]);
+		if (rotation_data == nullptr) {
+			UtilityFunctions::push_error("Error when trying to compile the spawn data. The BulletRotationData2D at index ", i, " is null. Ignoring the request");
+			return false;
+		}
+
+		compiled_rotation_data[i] = CompiledBulletRotationData2D{ rotation_data->rotation_speed, rotation_data->max_rotation_speed, rotation_data->rotation_acceleration };
+	}
+
+	return true;
+}
+
+bool MultiMeshBulletsData2D::begin_compiling_pattern(int amount_bullets) {
+	is_compiled = false;
+
+	if (amount_bullets <= 0) {
+		UtilityFunctions::push_error("Error when trying to compile a bullet pattern. The amount of bullets has to be bigger than 0. Ignoring the request");
+		return false;
+	}
+
+	return true;
+}
+
+bool MultiMeshBulletsData2D::compile_ring_pattern(int amount_bullets, real_t radius, real_t start_angle_radians) {
+	if (!begin_compiling_pattern(amount_bullets)) {
+		return false;
+	}
+
+	BulletPatternGenerator2D::generate_ring(compiled_transforms, amount_bullets, radius, start_angle_radians);
+	return finish_compile();
+}
+
+bool MultiMeshBulletsData2D::compile_arc_pattern(int amount_bullets, real_t radius, real_t spread_angle_radians, real_t center_angle_radians) {
+	if (!begin_compiling_pattern(amount_bullets)) {
+		return false;
+	}
+
+	BulletPatternGenerator2D::generate_arc(compiled_transforms, amount_bullets, radius, spread_angle_radians, center_angle_radians);
+	return finish_compile();
+}
+
+bool MultiMeshBulletsData2D::compile_spiral_pattern(int amount_bullets, real_t start_radius, real_t radius_step, real_t angle_step_radians, real_t start_angle_radians) {
+	if (!begin_compiling_pattern(amount_bullets)) {
+		return false;
+	}
+
+	BulletPatternGenerator2D::generate_spiral(compiled_transforms, amount_bullets, start_radius, radius_step, angle_step_radians, start_angle_radians);
+	return finish_compile();
+}
+
+bool MultiMeshBulletsData2D::compile_spread_pattern(int amount_bullets, real_t spread_angle_radians) {
+	if (!begin_compiling_pattern(amount_bullets)) {
+		return false;
+	}
+
+	BulletPatternGenerator2D::generate_spread(compiled_transforms, amount_bullets, spread_angle_radians);
+	return finish_compile();
+}
+
+bool MultiMeshBulletsData2D::compile_line_pattern(int amount_bullets, real_t length) {
+	if (!begin_compiling_pattern(amount_bullets)) {
+		return false;
+	}
+
+	BulletPatternGenerator2D::generate_line(compiled_transforms, amount_bullets, length);
+	return finish_compile();
+}
+
+bool MultiMeshBulletsData2D::compile_path_pattern(int amount_bullets, const Ref<Curve2D> &curve, bool rotate_with_path) {
+	if (!begin_compiling_pattern(amount_bullets)) {
+		return false;
+	}
+
+	if (curve.is_null()) {
+		UtilityFunctions::push_error("Error when trying to compile a path bullet pattern. The curve is null. Ignoring the request");
+		return false;
+	}
+
+	BulletPatternGenerator2D::generate_path(compiled_transforms, amount_bullets, curve, rotate_with_path);
+	return finish_compile();
+}
+
+bool MultiMeshBulletsData2D::compile_rotation_ramp(real_t start_rotation_speed, real_t end_rotation_speed, real_t max_rotation_speed, real_t rotation_acceleration) {
+	if (!is_compiled) {
+		UtilityFunctions::push_error("Error when trying to compile a rotation ramp. The spawn data has to be compiled first. Ignoring the request");
+		return false;
+	}
+
+	const int amount_bullets = static_cast<int>(compiled_transforms.size());
+	compiled_rotation_data.resize(amount_bullets);
+
+	for (int i = 0; i < amount_bullets; ++i) {
+		const real_t rotation_speed = Math::lerp(start_rotation_speed, end_rotation_speed, get_ramp_weight(i, amount_bullets));
+		compiled_rotation_data[i] = CompiledBulletRotationData2D{ rotation_speed, max_rotation_speed, rotation_acceleration };
+	}
+
+	return true;
+}
+
+bool MultiMeshBulletsData2D::get_is_compiled() const {
+	return is_compiled;
+}
+
 TypedArray<Transform2D> MultiMeshBulletsData2D::get_transforms() const {
 	return transforms;
 }
 void MultiMeshBulletsData2D::set_transforms(const TypedArray<Transform2D> &new_transforms) {
 	transforms = new_transforms;
+	is_compiled = false;
 }
 
 TypedArray<Texture2D> MultiMeshBulletsData2D::get_textures() const {
@@ -136,6 +273,7 @@ TypedArray<BulletRotationData2D> MultiMeshBulletsData2D::get_all_bullet_rotation
 }
 void MultiMeshBulletsData2D::set_all_bullet_rotation_data(const TypedArray<BulletRotationData2D> &new_bullet_rotation_data) {
 	all_bullet_rotation_data = new_bullet_rotation_data;
+	is_compiled = false;
 }
 
 bool MultiMeshBulletsData2D::get_rotate_only_textures() const {
@@ -373,5 +511,16 @@ void MultiMeshBulletsData2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "bullets_current_collision_count"), "set_bullets_current_collision_count", "get_bullets_current_collision_count");
 	
 	ClassDB::bind_static_method("MultiMeshBulletsData2D", D_METHOD("calculate_bitmask", "numbers"), &MultiMeshBulletsData2D::calculate_bitmask);
+
+	ClassDB::bind_method(D_METHOD("compile"), &MultiMeshBulletsData2D::compile);
+	ClassDB::bind_method(D_METHOD("get_is_compiled"), &MultiMeshBulletsData2D::get_is_compiled);
+
+	ClassDB::bind_method(D_METHOD("compile_ring_pattern", "amount_bullets", "radius", "start_angle_radians"), &MultiMeshBulletsData2D::compile_ring_pattern, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("compile_arc_pattern", "amount_bullets", "radius", "spread_angle_radians", "center_angle_radians"), &MultiMeshBulletsData2D::compile_arc_pattern, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("compile_spiral_pattern", "amount_bullets", "start_radius", "radius_step", "angle_step_radians", "start_angle_radians"), &MultiMeshBulletsData2D::compile_spiral_pattern, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("compile_spread_pattern", "amount_bullets", "spread_angle_radians"), &MultiMeshBulletsData2D::compile_spread_pattern);
+	ClassDB::bind_method(D_METHOD("compile_line_pattern", "amount_bullets", "length"), &MultiMeshBulletsData2D::compile_line_pattern);
+	ClassDB::bind_method(D_METHOD("compile_path_pattern", "amount_bullets", "curve", "rotate_with_path"), &MultiMeshBulletsData2D::compile_path_pattern, DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("compile_rotation_ramp", "start_rotation_speed", "end_rotation_speed", "max_rotation_speed", "rotation_acceleration"), &MultiMeshBulletsData2D::compile_rotation_ramp);
 }
 } //namespace BlastBullets2D
@@ -4,10 +4,12 @@
 #include "godot_cpp/variant/typed_array.hpp"
 
 #include <godot_cpp/classes/canvas_item_material.hpp>
+#include <godot_cpp/classes/curve2d.hpp>
 #include <godot_cpp/classes/mesh.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/classes/texture2d.hpp>
+#include <vector>
 
 namespace BlastBullets2D {
 using namespace godot;
@@ -112,6 +114,35 @@ public:
 	// Custom mesh, if it isn't provided then a Quadmesh will be generated and it will use the texture_size. If you DO provide a mesh then you should handle the scaling of the bullets yourself using a shader for best quality.
 	Ref<Mesh> mesh;
 
+	// COMPILED TEMPLATE
+
+	// Whether compile() was called successfully and none of the compiled arrays were replaced through their setters since then
+	bool is_compiled = false;
+
+	// Flat copies of the transforms and the rotation data, filled by compile(). The compiled rotation data is either empty (no rotation), a single entry shared by all bullets or one entry per bullet
+	std::vector<Transform2D> compiled_transforms;
+	std::vector<CompiledBulletRotationData2D> compiled_rotation_data;
+
+	// Validates the per-bullet arrays once and copies them into flat native arrays, so spawning this data from a template copies them straight into the bullets instead of converting every element from Variant. Only the *_from_template spawn methods and emitters read the compiled arrays, the ordinary spawn methods always read the per-bullet arrays. The arrays are copied, so changing them in place afterwards requires calling compile() again (replacing them through a setter un-compiles the data). Returns false if the data is invalid
+	bool compile();
+	bool get_is_compiled() const;
+
+	// Pattern generators - instead of compiling the transforms array, they generate the pattern straight into the compiled transforms (the transforms array is left untouched) and compile the rest of the data. The patterns are relative to the spawn origin and aim to the right, so they are meant to be spawned from a template. Return false if the data is invalid
+	bool compile_ring_pattern(int amount_bullets, real_t radius, real_t start_angle_radians = 0.0);
+	bool compile_arc_pattern(int amount_bullets, real_t radius, real_t spread_angle_radians, real_t center_angle_radians = 0.0);
+	bool compile_spiral_pattern(int amount_bullets, real_t start_radius, real_t radius_step, real_t angle_step_radians, real_t start_angle_radians = 0.0);
+	bool compile_spread_pattern(int amount_bullets, real_t spread_angle_radians);
+	bool compile_line_pattern(int amount_bullets, real_t length);
+	bool compile_path_pattern(int amount_bullets, const Ref<Curve2D> &curve, bool rotate_with_path = true);
+
+	// Overrides the compiled rotation data with one entry per bullet, where the rotation speed goes from the start value (first bullet) to the end value (last bullet). Call after compiling, any later compile call replaces it
+	bool compile_rotation_ramp(real_t start_rotation_speed, real_t end_rotation_speed, real_t max_rotation_speed, real_t rotation_acceleration);
+
+	// The amount of bullets that spawning this data produces, either from the compiled arrays (templates and emitters) or from the per-bullet arrays (ordinary spawns)
+	_ALWAYS_INLINE_ int get_amount_bullets_to_spawn(bool use_compiled_data) const {
+		return use_compiled_data ? static_cast<int>(compiled_transforms.size()) : static_cast<int>(transforms.size());
+	}
+
 	// Used to acquire a bitmask from an array of integer values. Useful when setting the collision layer and collision mask. Example: you want your bullets to be in collision layer 1,2,3,7, you would pass an array of these numbers and the value that gets returned is the value you need to set to the collision_layer. Pass ONLY POSITIVE NUMBERS (NEVER PASS NEGATIVE OR ZERO)
 	static int calculate_bitmask(const TypedArray<int> &numbers);
 
@@ -210,5 +241,19 @@ public:
 
 protected:
 	static void _bind_methods();
+
+	// Compiles everything except the transforms (which have to be compiled already). Returns false if the data is invalid
+	virtual bool compile_bullet_data();
+
+	// Marks the data as compiled if the rest of the data compiles as well
+	bool finish_compile();
+
+	// Un-compiles the data and checks whether a pattern can be generated with that amount of bullets
+	bool begin_compiling_pattern(int amount_bullets);
+
+	// The interpolation weight of a bullet inside a ramp (0 for the first bullet, 1 for the last one)
+	_ALWAYS_INLINE_ real_t get_ramp_weight(int bullet_index, int amount_bullets) const {
+		return amount_bullets > 1 ? static_cast<real_t>(bullet_index) / (amount_bullets - 1) : 0.0;
+	}
 };
 } //namespace BlastBullets2D
@@ -0,0 +1,102 @@
+extends Node2D
+
+# Spams collisions into the collision inboxes of the bullets and checks that every single one of them reaches the main thread exactly once (no lost and no duplicated collisions)
+# The inboxes only get written from another thread when the physics run on a separate thread, so the test refuses to run (and fails) unless physics/2d/run_on_separate_thread is enabled. Enable it by placing an override.cfg next to project.godot that contains:
+# [physics]
+# 2d/run_on_separate_thread=true
+# Then run the scene on its own, the result gets printed and the scene quits:
+# godot --headless res://benchmark_scene/micro_benchmarks/collision_inbox_stress_test.tscn
+
+const SPAM_FRAMES:int = 120
+const MULTIMESHES_PER_FRAME:int = 20
+const BULLETS_PER_MULTIMESH:int = 100
+
+# How long to wait for the last collisions to arrive before giving up
+const MAX_SETTLE_FRAMES:int = 120
+
+@onready var factory:BulletFactory2D = $BulletFactory2D
+
+var bullets_data:DirectionalBulletsData2D
+
+# Pooled multimeshes get re-used, so every hit is identified by the multimesh, how many times it was spawned and the bullet index
+var spawn_generations:Dictionary[int, int] = {}
+var received_hits:Dictionary[String, bool] = {}
+var spawned_multimeshes:Dictionary[int, MultiMeshBullets2D] = {}
+
+var amount_hits:int = 0
+var amount_duplicated_hits:int = 0
+
+func _ready() -> void:
+	# Without a separate physics thread the inboxes are only ever written from the main thread, so a pass would prove nothing
+	if not ProjectSettings.get_setting("physics/2d/run_on_separate_thread", false):
+		push_error("The collision inbox stress test needs physics/2d/run_on_separate_thread to be enabled, see the comment at the top of the script")
+		print("FAILED")
+		get_tree().quit(1)
+		return
+	
+	bullets_data = DirectionalBulletsData2D.new()
+	bullets_data.texture_size = Vector2(8, 8)
+	bullets_data.collision_shape_size = Vector2(8, 8)
+	bullets_data.is_life_time_infinite = true
+	
+	# Every bullet gets disabled by its first collision, so each one of them has to be reported exactly once
+	bullets_data.bullet_max_collision_count = 1
+	bullets_data.set_collision_layer_from_array([2])
+	bullets_data.set_collision_mask_from_array([3])
+	
+	var sp_data:BulletSpeedData2D = BulletSpeedData2D.new()
+	sp_data.speed = 10
+	sp_data.max_speed = 10
+	sp_data.acceleration = 0
+	bullets_data.all_bullet_speed_data = [sp_data]
+	
+	# Spawned inside the target, so all bullets collide during the next physics step
+	bullets_data.transforms = BulletFactory2D.helper_generate_transforms_grid(BULLETS_PER_MULTIMESH, Transform2D(0, Vector2(-100, -100)), 10, BulletFactory2D.CENTER_LEFT, 20, 20)
+	
+	factory.area_entered.connect(_on_area_entered)
+	
+	run_stress_test()
+
+func run_stress_test() -> void:
+	for i in SPAM_FRAMES:
+		for j in MULTIMESHES_PER_FRAME:
+			var multimesh:DirectionalBullets2D = factory.spawn_controllable_directional_bullets(bullets_data)
+			var id:int = multimesh.get_instance_id()
+			
+			spawn_generations[id] = spawn_generations.get(id, 0) + 1
+			spawned_multimeshes[id] = multimesh
+		
+		await get_tree().physics_frame
+	
+	var amount_expected_hits:int = SPAM_FRAMES * MULTIMESHES_PER_FRAME * BULLETS_PER_MULTIMESH
+	
+	for i in MAX_SETTLE_FRAMES:
+		if amount_hits >= amount_expected_hits:
+			break
+		await get_tree().physics_frame
+	
+	var amount_dropped:int = 0
+	for multimesh in spawned_multimeshes.values():
+		amount_dropped += multimesh.get_amount_dropped_collisions()
+	
+	var amount_lost:int = amount_expected_hits - received_hits.size()
+	var passed:bool = amount_lost == 0 and amount_duplicated_hits == 0 and amount_dropped == 0
+	
+	print("Collision inbox stress test (%d bullets in %d multimeshes, separate physics thread: %s)" % [amount_expected_hits, spawned_multimeshes.size(), ProjectSettings.get_setting("physics/2d/run_on_separate_thread", false)])
+	print("Lost collisions: %d, duplicated collisions: %d, dropped because of a full inbox: %d" % [amount_lost, amount_duplicated_hits, amount_dropped])
+	print("PASSED" if passed else "FAILED")
+	
+	factory.reset()
+	get_tree().quit(0 if passed else 1)
+
+func _on_area_entered(_hit_target_area:Object, multimesh:MultiMeshBullets2D, bullet_index:int, _bullets_custom_data:Resource, _bullet_global_transform:Transform2D) -> void:
+	var id:int = multimesh.get_instance_id()
+	var key:String = "%d:%d:%d" % [id, spawn_generations.get(id, 0), bullet_index]
+	
+	amount_hits += 1
+	
+	if received_hits.has(key):
+		amount_duplicated_hits += 1
+		return
+	
+	received_hits[key] = true
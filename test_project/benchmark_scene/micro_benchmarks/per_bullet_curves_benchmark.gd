@@ -0,0 +1,78 @@
+extends Node2D
+
+# Measures how much moving a single bullet costs when 0%, 10% and 100% of the bullets have their own BulletCurvesData2D (set with bullet_set_curves_data)
+# Run it on its own, the results get printed and the scene quits once every scenario was measured:
+# godot --headless res://benchmark_scene/micro_benchmarks/per_bullet_curves_benchmark.tscn
+
+const AMOUNT_MULTIMESHES:int = 100
+const BULLETS_PER_MULTIMESH:int = 100
+const WARM_UP_FRAMES:int = 30
+const MEASURED_FRAMES:int = 300
+
+# The share of bullets inside each multimesh that get per-bullet curves
+const SCENARIOS:Array[float] = [0.0, 0.1, 1.0]
+
+@onready var factory:BulletFactory2D = $BulletFactory2D
+
+var curves_data:BulletCurvesData2D = preload("res://shared/data/bullet_curves_data_1.tres")
+var bullets_data:DirectionalBulletsData2D
+
+func _ready() -> void:
+	bullets_data = DirectionalBulletsData2D.new()
+	bullets_data.texture_size = Vector2(16, 16)
+	bullets_data.collision_shape_size = Vector2(8, 8)
+	bullets_data.is_life_time_infinite = true
+	
+	# No collisions, so that only the movement gets measured
+	bullets_data.collision_layer = 0
+	bullets_data.collision_mask = 0
+	
+	var sp_data:BulletSpeedData2D = BulletSpeedData2D.new()
+	sp_data.speed = 100
+	sp_data.max_speed = 100
+	sp_data.acceleration = 0
+	bullets_data.all_bullet_speed_data = [sp_data]
+	
+	bullets_data.transforms = BulletFactory2D.helper_generate_transforms_grid(BULLETS_PER_MULTIMESH, Transform2D(), 10, BulletFactory2D.CENTER_LEFT, 20, 20)
+	
+	run_benchmark()
+
+func run_benchmark() -> void:
+	var results:PackedStringArray = []
+	
+	for curves_ratio in SCENARIOS:
+		spawn_bullets(curves_ratio)
+		
+		for i in WARM_UP_FRAMES:
+			await get_tree().physics_frame
+		
+		var total_usec:float = 0.0
+		for i in MEASURED_FRAMES:
+			await get_tree().physics_frame
+			total_usec += Performance.get_monitor(Performance.TIME_PHYSICS_PROCESS) * 1_000_000.0
+		
+		var amount_bullets:int = AMOUNT_MULTIMESHES * BULLETS_PER_MULTIMESH
+		var usec_per_frame:float = total_usec / MEASURED_FRAMES
+		var nsec_per_bullet:float = usec_per_frame * 1000.0 / amount_bullets
+		
+		results.push_back("%3d%% per-bullet curves: %8.1f usec per physics frame, %6.1f nsec per bullet" % [int(curves_ratio * 100), usec_per_frame, nsec_per_bullet])
+		
+		factory.reset()
+		await get_tree().physics_frame
+	
+	print("Per-bullet curves benchmark (%d bullets, %d physics frames each)" % [AMOUNT_MULTIMESHES * BULLETS_PER_MULTIMESH, MEASURED_FRAMES])
+	for line in results:
+		print(line)
+	
+	get_tree().quit()
+
+func spawn_bullets(curves_ratio:float) -> void:
+	var amount_with_curves:int = int(BULLETS_PER_MULTIMESH * curves_ratio)
+	
+	for i in AMOUNT_MULTIMESHES:
+		var multimesh:DirectionalBullets2D = factory.spawn_controllable_directional_bullets(bullets_data)
+		
+		# Spread the bullets with curves evenly across the multimesh, so they aren't all packed at the front of the storage
+		for j in amount_with_curves:
+			var bullet_index:int = int(j * BULLETS_PER_MULTIMESH / float(amount_with_curves))
+			multimesh.bullet_set_curves_data(bullet_index, curves_data)